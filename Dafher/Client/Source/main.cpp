@@ -4,6 +4,11 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance
 {
 	Engine::GetInstance()->Init();
 
+	if (std::wcsstr(lpCmdLine, L"--render-thread") != nullptr)
+	{
+		Engine::GetInstance()->SetRenderThreadEnabled(true);
+	}
+
     MSG msg;
     while (true)
     {
@@ -0,0 +1,893 @@
+﻿#include "AssetCooker.h"
+#include "AssetManifest.h"
+#include "AssetPack.h"
+#include "FileIO.h"
+#include "ImageResizer.h"
+#include "Platform.h"
+#include "RenderQueue.h"
+#include "Renderer.h"
+#include "SoftwareRenderer.h"
+#include "Texture.h"
+#include "TextureManager.h"
+#include "ThreadPool.h"
+#include "VirtualTexture.h"
+#include "stb_image_write.h"
+
+static int BenchmarkResize() noexcept
+{
+	const uint32 imageSizes[] = { 512, 1024, 2048, 4096 };
+	const uint32 maxThreadCount = MAX(1u, std::thread::hardware_concurrency());
+	bool isIdentical = true;
+
+	for (uint32 imageSize : imageSizes)
+	{
+		const uint32 outputSize = imageSize * 3 / 4;
+		std::vector<uint8> input(static_cast<size_t>(imageSize) * imageSize * 4);
+		std::vector<uint8> reference(static_cast<size_t>(outputSize) * outputSize * 4);
+		std::vector<uint8> output(reference.size());
+
+		uint32 seed = imageSize;
+
+		for (uint8& value : input)
+		{
+			seed = seed * 1664525u + 1013904223u;
+			value = static_cast<uint8>(seed >> 24);
+		}
+
+		ImageResizer::Resize(input.data(), imageSize, imageSize, reference.data(), outputSize, outputSize);
+
+		for (uint32 threadCount = 1; threadCount <= maxThreadCount; threadCount *= 2)
+		{
+			std::unique_ptr<ThreadPool> threadPool = threadCount > 1 ? std::make_unique<ThreadPool>(threadCount - 1) : nullptr;
+			float bestTime = std::numeric_limits<float>::max();
+
+			for (uint32 run = 0; run < 5; ++run)
+			{
+				std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+				ImageResizer::Resize(input.data(), imageSize, imageSize, output.data(), outputSize, outputSize, threadPool.get());
+
+				std::chrono::duration<float, std::milli> resizeTime = std::chrono::steady_clock::now() - startTime;
+				bestTime = MIN(bestTime, resizeTime.count());
+			}
+
+			const bool isSame = output == reference;
+			isIdentical = isIdentical && isSame;
+
+			std::printf("resize %ux%u -> %ux%u on %2u threads: %8.2f ms%s\n",
+				imageSize, imageSize, outputSize, outputSize, threadCount, bestTime, isSame ? "" : " (MISMATCH)");
+		}
+	}
+
+	return isIdentical ? 0 : 1;
+}
+
+static int BenchmarkSort() noexcept
+{
+	const uint32 keyCounts[] = { 10000, 100000 };
+	bool isIdentical = true;
+
+	for (uint32 keyCount : keyCounts)
+	{
+		std::vector<RenderQueueEntry> entries(keyCount);
+		uint32 seed = keyCount;
+
+		for (uint32 i = 0; i < keyCount; ++i)
+		{
+			seed = seed * 1664525u + 1013904223u;
+			const uint8 layer = static_cast<uint8>(seed >> 29);
+			const BlendMode blendMode = (seed >> 28) & 1 ? BlendMode::Additive : BlendMode::Alpha;
+			const uint32 textureId = (seed >> 16) & 0xFF;
+
+			seed = seed * 1664525u + 1013904223u;
+			const float depth = static_cast<float>(seed >> 8) / static_cast<float>(1u << 24) * 200.0f - 100.0f;
+
+			entries[i] = { RenderQueue::MakeKey(layer, blendMode, textureId, depth), i };
+		}
+
+		std::vector<RenderQueueEntry> reference = entries;
+		std::stable_sort(reference.begin(), reference.end(),
+			[](const RenderQueueEntry& lhs, const RenderQueueEntry& rhs)
+			{
+				return lhs._key < rhs._key;
+			});
+
+		RenderQueue renderQueue;
+		float radixTime = std::numeric_limits<float>::max();
+		float stableSortTime = std::numeric_limits<float>::max();
+		float sortTime = std::numeric_limits<float>::max();
+		bool isSame = true;
+
+		for (uint32 run = 0; run < 5; ++run)
+		{
+			renderQueue.Clear();
+
+			for (const RenderQueueEntry& entry : entries)
+			{
+				renderQueue.Push(entry._key, entry._index);
+			}
+
+			renderQueue.Sort();
+			radixTime = MIN(radixTime, renderQueue.GetLastSortTime());
+
+			const std::vector<RenderQueueEntry>& sorted = renderQueue.GetEntries();
+
+			for (uint32 i = 0; i < keyCount; ++i)
+			{
+				isSame = isSame && sorted[i]._key == reference[i]._key && sorted[i]._index == reference[i]._index;
+			}
+
+			std::vector<RenderQueueEntry> stableSorted = entries;
+			std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+			std::stable_sort(stableSorted.begin(), stableSorted.end(),
+				[](const RenderQueueEntry& lhs, const RenderQueueEntry& rhs)
+				{
+					return lhs._key < rhs._key;
+				});
+			std::chrono::duration<float, std::milli> time = std::chrono::steady_clock::now() - startTime;
+			stableSortTime = MIN(stableSortTime, time.count());
+
+			std::vector<RenderQueueEntry> unstableSorted = entries;
+			startTime = std::chrono::steady_clock::now();
+			std::sort(unstableSorted.begin(), unstableSorted.end(),
+				[](const RenderQueueEntry& lhs, const RenderQueueEntry& rhs)
+				{
+					return lhs._key < rhs._key;
+				});
+			time = std::chrono::steady_clock::now() - startTime;
+			sortTime = MIN(sortTime, time.count());
+		}
+
+		isIdentical = isIdentical && isSame;
+
+		std::printf("sort %6u keys: radix %8.3f ms, std::stable_sort %8.3f ms, std::sort %8.3f ms%s\n",
+			keyCount, radixTime, stableSortTime, sortTime, isSame ? "" : " (MISMATCH)");
+	}
+
+	return isIdentical ? 0 : 1;
+}
+
+constexpr static uint32 GOLDEN_SIZE = 256;
+
+static void SubmitGoldenQuad(Renderer& renderer, Texture* texture, const Vector2& axisX, const Vector2& axisY,
+	const Vector3& origin, const Vector4& uvRect, const Color& color, uint8 layer, BlendMode blendMode) noexcept
+{
+	const Matrix worldMatrix(
+		axisX.x, axisX.y, 0.0f, 0.0f,
+		axisY.x, axisY.y, 0.0f, 0.0f,
+		0.0f, 0.0f, 1.0f, 0.0f,
+		origin.x, origin.y, origin.z, 1.0f);
+
+	renderer.Submit(texture, worldMatrix, uvRect, color, layer, blendMode);
+}
+
+static int RenderGolden(const std::filesystem::path& referencePath, bool isUpdate) noexcept
+{
+	std::vector<unsigned char> checkerData(16 * 16 * 4);
+	std::vector<unsigned char> gradientData(32 * 8 * 4);
+
+	for (uint32 y = 0; y < 16; ++y)
+	{
+		for (uint32 x = 0; x < 16; ++x)
+		{
+			const unsigned char evenTexel[4] = { 255, 64, 32, 255 };
+			const unsigned char oddTexel[4] = { 32, 128, 255, 160 };
+			const bool isEven = ((x / 4) + (y / 4)) % 2 == 0;
+			std::memcpy(&checkerData[(static_cast<size_t>(y) * 16 + x) * 4], isEven ? evenTexel : oddTexel, sizeof(evenTexel));
+		}
+	}
+
+	for (uint32 y = 0; y < 8; ++y)
+	{
+		for (uint32 x = 0; x < 32; ++x)
+		{
+			const unsigned char texel[4] = { static_cast<unsigned char>(x * 8), static_cast<unsigned char>(y * 32),
+				128u, static_cast<unsigned char>(255 - x * 4) };
+			std::memcpy(&gradientData[(static_cast<size_t>(y) * 32 + x) * 4], texel, sizeof(texel));
+		}
+	}
+
+	Texture checker;
+	Texture gradient;
+	Texture white;
+	checker.CreateFromImageData(nullptr, std::move(checkerData), 16, 16);
+	gradient.CreateFromImageData(nullptr, std::move(gradientData), 32, 8);
+	white.CreateFromImageData(nullptr, std::vector<unsigned char>(4, 255), 1, 1);
+
+	Renderer renderer;
+	renderer.SetScreenSize(GOLDEN_SIZE, GOLDEN_SIZE);
+
+	RenderSnapshot snapshot;
+	renderer.Begin(snapshot);
+
+	const Vector4 fullRect(0.0f, 0.0f, 1.0f, 1.0f);
+	SubmitGoldenQuad(renderer, &checker, Vector2(256.0f, 0.0f), Vector2(0.0f, 256.0f), Vector3(-128.0f, -128.0f, 0.0f),
+		fullRect, Color(0.5f, 0.5f, 0.5f, 1.0f), 0, BlendMode::Alpha);
+	SubmitGoldenQuad(renderer, &gradient, Vector2(160.0f, 0.0f), Vector2(0.0f, 40.0f), Vector3(-100.0f, 60.0f, 0.0f),
+		fullRect, Color(1.0f, 1.0f, 1.0f, 1.0f), 1, BlendMode::Alpha);
+	SubmitGoldenQuad(renderer, &checker, Vector2(48.0f, 24.0f), Vector2(-24.0f, 48.0f), Vector3(-20.0f, -70.0f, 0.0f),
+		fullRect, Color(1.0f, 0.75f, 0.5f, 0.75f), 1, BlendMode::Alpha);
+	SubmitGoldenQuad(renderer, &gradient, Vector2(0.0f, 96.0f), Vector2(-24.0f, 0.0f), Vector3(100.0f, -90.0f, 0.0f),
+		Vector4(0.25f, 0.0f, 0.75f, 1.0f), Color(1.0f, 1.0f, 1.0f, 1.0f), 1, BlendMode::Alpha);
+	SubmitGoldenQuad(renderer, &checker, Vector2(90.0f, 0.0f), Vector2(0.0f, 90.0f), Vector3(-64.5f, -30.25f, 0.0f),
+		Vector4(0.25f, 0.25f, 0.75f, 0.75f), Color(0.25f, 0.5f, 1.0f, 0.5f), 2, BlendMode::Additive);
+	SubmitGoldenQuad(renderer, &white, Vector2(20.0f, 0.0f), Vector2(0.0f, 200.0f), Vector3(54.0f, -100.0f, 0.0f),
+		fullRect, Color(1.0f, 0.0f, 0.5f, 0.25f), 2, BlendMode::Alpha);
+
+	renderer.End();
+
+	SoftwareRenderer softwareRenderer(GOLDEN_SIZE, GOLDEN_SIZE);
+	softwareRenderer.SetClearColor(Color(0.25f, 0.0f, 0.5f, 1.0f));
+
+	// Every run renders the same image, so the fastest run gives the throughput numbers.
+	SoftwareRenderStats bestStats = {};
+	bestStats._renderTime = std::numeric_limits<float>::max();
+
+	for (uint32 run = 0; run < 5; ++run)
+	{
+		softwareRenderer.Render(snapshot);
+
+		if (softwareRenderer.GetStats()._renderTime < bestStats._renderTime)
+		{
+			bestStats = softwareRenderer.GetStats();
+		}
+	}
+
+	std::printf("software render: %u sprites, %llu pixels on %u threads in %.3f ms, %.0f sprites/s, %.2f megapixels/s\n",
+		bestStats._spriteCount, static_cast<unsigned long long>(bestStats._pixelCount), bestStats._threadCount,
+		bestStats._renderTime, bestStats._spritesPerSecond, bestStats._megapixelsPerSecond);
+
+	if (isUpdate)
+	{
+		const bool isSaved = softwareRenderer.SaveImage(referencePath);
+		std::printf("golden %s: %s\n", referencePath.string().c_str(), isSaved ? "updated" : "failed to save");
+		return isSaved ? 0 : 1;
+	}
+
+	Texture reference;
+	std::error_code errorCode;
+
+	if (!std::filesystem::exists(referencePath, errorCode) || !reference.LoadImageFromFile(referencePath) ||
+		reference.GetOriginalWidth() != GOLDEN_SIZE || reference.GetOriginalHeight() != GOLDEN_SIZE)
+	{
+		std::printf("golden %s: missing or not %ux%u\n", referencePath.string().c_str(), GOLDEN_SIZE, GOLDEN_SIZE);
+		return 1;
+	}
+
+	const std::vector<uint8>& pixels = softwareRenderer.GetPixels();
+	const uint8* referencePixels = reference.GetPixels();
+	uint32 mismatchCount = 0;
+	uint32 maxDifference = 0;
+
+	for (size_t i = 0; i < pixels.size(); i += 4)
+	{
+		uint32 difference = 0;
+
+		for (size_t c = 0; c < 4; ++c)
+		{
+			difference = MAX(difference, static_cast<uint32>(std::abs(pixels[i + c] - referencePixels[i + c])));
+		}
+
+		mismatchCount += difference > 0 ? 1 : 0;
+		maxDifference = MAX(maxDifference, difference);
+	}
+
+	std::printf("golden %s: %u sprites, %u of %u pixels differ (max %u)\n", referencePath.string().c_str(),
+		softwareRenderer.GetStats()._spriteCount, mismatchCount, GOLDEN_SIZE * GOLDEN_SIZE, maxDifference);
+
+	if (mismatchCount > 0)
+	{
+		const std::filesystem::path actualPath = std::filesystem::path(AssetCooker::CACHE_PATH) /
+			(referencePath.stem().string() + ".actual.png");
+
+		std::filesystem::create_directories(actualPath.parent_path(), errorCode);
+		softwareRenderer.SaveImage(actualPath);
+		std::printf("actual image written to %s\n", actualPath.string().c_str());
+	}
+
+	return mismatchCount == 0 ? 0 : 1;
+}
+
+static uint64 TouchBuffer(const IoBuffer& buffer) noexcept
+{
+	uint64 checksum = 0;
+
+	for (uint64 offset = 0; offset < buffer.GetSize(); offset += 64)
+	{
+		checksum += buffer.GetData()[offset];
+	}
+
+	return checksum;
+}
+
+static void BenchmarkFileSet(const char* name, const std::vector<std::filesystem::path>& files, ThreadPool* threadPool) noexcept
+{
+	uint64 totalBytes = 0;
+
+	for (const std::filesystem::path& filePath : files)
+	{
+		totalBytes += std::filesystem::file_size(filePath);
+	}
+
+	const float totalMegabytes = static_cast<float>(totalBytes) / (1024.0f * 1024.0f);
+
+	auto report = [name, totalMegabytes, &files](const char* backend, float time, float averageLatency, float maxLatency)
+	{
+		std::printf("%-6s %-14s %5zu files %8.1f MB %9.2f ms %9.1f MB/s  latency avg %7.2f ms max %7.2f ms\n",
+			name, backend, files.size(), totalMegabytes, time, totalMegabytes * 1000.0f / MAX(time, 0.001f), averageLatency, maxLatency);
+	};
+
+	const IoMode modes[] = { IoMode::Read, IoMode::Map };
+	const char* blockingNames[] = { "blocking read", "blocking map" };
+
+	for (uint32 i = 0; i < 2; ++i)
+	{
+		std::atomic<uint64> checksum = 0;
+		float maxLatency = 0.0f;
+		std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+		for (const std::filesystem::path& filePath : files)
+		{
+			std::chrono::steady_clock::time_point readTime = std::chrono::steady_clock::now();
+			IoBuffer buffer;
+
+			if (buffer.Load(filePath, modes[i]))
+			{
+				checksum += TouchBuffer(buffer);
+			}
+
+			std::chrono::duration<float, std::milli> latency = std::chrono::steady_clock::now() - readTime;
+			maxLatency = MAX(maxLatency, latency.count());
+		}
+
+		std::chrono::duration<float, std::milli> time = std::chrono::steady_clock::now() - startTime;
+		report(blockingNames[i], time.count(), time.count() / files.size(), maxLatency);
+	}
+
+	const char* asyncNames[2][2] = { { "pool read", "pool map" }, { "io_uring read", "io_uring map" } };
+
+	for (uint32 isUringEnabled = 0; isUringEnabled < 2; ++isUringEnabled)
+	{
+		for (uint32 i = 0; i < 2; ++i)
+		{
+			FileIO fileIO(threadPool, isUringEnabled != 0);
+
+			if (isUringEnabled != 0 && !fileIO.IsUringEnabled())
+			{
+				std::printf("%-6s %-14s unavailable\n", name, asyncNames[1][i]);
+				continue;
+			}
+
+			std::atomic<uint64> checksum = 0;
+			std::vector<IoRequest> requests;
+
+			for (const std::filesystem::path& filePath : files)
+			{
+				requests.push_back({ filePath, [&checksum](IoStatus status, IoBuffer& buffer)
+					{
+						if (status == IoStatus::Completed)
+						{
+							checksum += TouchBuffer(buffer);
+						}
+					}, IoPriority::Normal, modes[i] });
+			}
+
+			std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+			fileIO.SubmitBatch(requests);
+			fileIO.Wait();
+			std::chrono::duration<float, std::milli> time = std::chrono::steady_clock::now() - startTime;
+
+			const IoStats stats = fileIO.GetStats();
+			report(asyncNames[isUringEnabled][i], time.count(), stats._averageLatency, stats._maxLatency);
+		}
+	}
+}
+
+static int BenchmarkIO(const std::filesystem::path& folderPath) noexcept
+{
+	const uint32 smallFileCount = 1024;
+	const uint32 smallFileSize = 16 * 1024;
+	const uint32 largeFileCount = 4;
+	const uint32 largeFileSize = 64 * 1024 * 1024;
+
+	std::error_code errorCode;
+	std::filesystem::create_directories(folderPath, errorCode);
+
+	auto writeFiles = [&folderPath](const char* prefix, uint32 count, uint32 size, std::vector<std::filesystem::path>& files)
+	{
+		std::vector<char> data(size);
+
+		for (uint32 i = 0; i < count; ++i)
+		{
+			uint32 seed = i + 1;
+
+			for (char& value : data)
+			{
+				seed = seed * 1664525u + 1013904223u;
+				value = static_cast<char>(seed >> 24);
+			}
+
+			files.push_back(folderPath / (prefix + std::to_string(i) + ".bin"));
+			std::ofstream file(files.back(), std::ios::binary | std::ios::trunc);
+			file.write(data.data(), static_cast<std::streamsize>(data.size()));
+		}
+	};
+
+	std::vector<std::filesystem::path> smallFiles;
+	std::vector<std::filesystem::path> largeFiles;
+	writeFiles("small_", smallFileCount, smallFileSize, smallFiles);
+	writeFiles("large_", largeFileCount, largeFileSize, largeFiles);
+
+	ThreadPool threadPool;
+	std::printf("file i/o on %u threads (warm page cache)\n", threadPool.GetThreadCount());
+
+	BenchmarkFileSet("small", smallFiles, &threadPool);
+	BenchmarkFileSet("large", largeFiles, &threadPool);
+
+	std::filesystem::remove_all(folderPath, errorCode);
+
+	return 0;
+}
+
+static uint64 TouchTexture(const Texture& texture) noexcept
+{
+	uint64 checksum = 0;
+	const unsigned char* pixels = texture.GetPixels();
+	const unsigned char* mipPixels = texture.GetMipPixels();
+
+	for (size_t offset = 0; offset < texture.GetImageSize(); offset += 64)
+	{
+		checksum += pixels[offset];
+	}
+
+	for (size_t offset = 0; offset < texture.GetMipChainSize(); offset += 64)
+	{
+		checksum += mipPixels[offset];
+	}
+
+	return checksum;
+}
+
+static std::vector<std::filesystem::path> WriteBenchmarkImages(const std::filesystem::path& folderPath,
+	const std::string& prefix, uint32 imageCount, uint32 imageSize) noexcept
+{
+	std::error_code errorCode;
+	std::filesystem::create_directories(folderPath, errorCode);
+
+	std::vector<std::filesystem::path> imagePaths;
+	std::vector<uint8> image(static_cast<size_t>(imageSize) * imageSize * 4);
+
+	for (uint32 i = 0; i < imageCount; ++i)
+	{
+		uint32 seed = i + 1;
+
+		for (uint32 y = 0; y < imageSize; ++y)
+		{
+			for (uint32 x = 0; x < imageSize; ++x)
+			{
+				seed = seed * 1664525u + 1013904223u;
+				uint8* texel = &image[(static_cast<size_t>(y) * imageSize + x) * 4];
+				texel[0] = static_cast<uint8>(x + i * 7);
+				texel[1] = static_cast<uint8>(y + i * 13);
+				texel[2] = static_cast<uint8>((x ^ y) + (seed >> 29));
+				texel[3] = 255;
+			}
+		}
+
+		imagePaths.push_back(folderPath / (prefix + std::to_string(i) + ".png"));
+		stbi_write_png(imagePaths.back().string().c_str(), static_cast<int>(imageSize), static_cast<int>(imageSize),
+			4, image.data(), static_cast<int>(imageSize * 4));
+	}
+
+	return imagePaths;
+}
+
+static int BenchmarkLoad(const std::filesystem::path& folderPath) noexcept
+{
+	const uint32 textureCount = 128;
+	const uint32 textureSize = 256;
+	const uint32 maxThreadCount = MAX(1u, std::thread::hardware_concurrency());
+
+	std::error_code errorCode;
+	std::filesystem::remove_all(folderPath, errorCode);
+
+	const std::vector<std::filesystem::path> imagePaths = WriteBenchmarkImages(folderPath, "load_benchmark_", textureCount, textureSize);
+	std::vector<uint64> referenceChecksums;
+	std::vector<uint64> checksums(imagePaths.size());
+	float serialTime = 0.0f;
+	bool isIdentical = true;
+
+	for (uint32 threadCount = 1; threadCount <= maxThreadCount; threadCount *= 2)
+	{
+		// Each texture goes through the same decode and mip steps TextureManager::LoadAll spreads
+		// across the engine's thread pool at startup.
+		std::unique_ptr<ThreadPool> threadPool = threadCount > 1 ? std::make_unique<ThreadPool>(threadCount - 1) : nullptr;
+		const std::function<void(uint32)> loadTexture = [&imagePaths, &checksums](uint32 index)
+		{
+			Texture texture;
+			const bool isLoaded = texture.LoadImageFromFile(imagePaths[index]) && texture.GenerateMips();
+			checksums[index] = isLoaded ? TouchTexture(texture) : 0;
+		};
+
+		float bestTime = std::numeric_limits<float>::max();
+
+		for (uint32 run = 0; run < 5; ++run)
+		{
+			std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+			if (threadPool != nullptr)
+			{
+				threadPool->ParallelFor(static_cast<uint32>(imagePaths.size()), loadTexture);
+			}
+			else
+			{
+				for (uint32 i = 0; i < static_cast<uint32>(imagePaths.size()); ++i)
+				{
+					loadTexture(i);
+				}
+			}
+
+			std::chrono::duration<float, std::milli> loadTime = std::chrono::steady_clock::now() - startTime;
+			bestTime = MIN(bestTime, loadTime.count());
+		}
+
+		if (threadCount == 1)
+		{
+			referenceChecksums = checksums;
+			serialTime = bestTime;
+		}
+
+		const bool isSame = checksums == referenceChecksums;
+		isIdentical = isIdentical && isSame;
+
+		std::printf("load %u textures of %ux%u on %2u threads: %8.2f ms (%6.3f ms/texture, %.2fx)%s\n",
+			textureCount, textureSize, textureSize, threadCount, bestTime, bestTime / textureCount,
+			serialTime / bestTime, isSame ? "" : " (MISMATCH)");
+	}
+
+	std::filesystem::remove_all(folderPath, errorCode);
+
+	return isIdentical ? 0 : 1;
+}
+
+static int BenchmarkPack(const std::filesystem::path& folderPath) noexcept
+{
+	const uint32 textureCount = 96;
+	const uint32 textureSize = 256;
+
+	const std::filesystem::path resourcePath = folderPath / "Resources";
+	const std::filesystem::path manifestPath = resourcePath / std::filesystem::path(TextureManager::MANIFEST_PATH).filename();
+	const std::filesystem::path packPath = resourcePath / std::filesystem::path(TextureManager::PACK_PATH).filename();
+
+	std::error_code errorCode;
+	std::filesystem::remove_all(folderPath, errorCode);
+	WriteBenchmarkImages(resourcePath, "pack_benchmark_", textureCount, textureSize);
+
+	ThreadPool threadPool;
+	AssetCooker cooker(&threadPool);
+	AssetManifest manifest;
+
+	if (!cooker.Cook(resourcePath, manifestPath, packPath, folderPath / "Cache") || !manifest.Open(manifestPath))
+	{
+		std::printf("failed to cook %s\n", resourcePath.string().c_str());
+		std::filesystem::remove_all(folderPath, errorCode);
+		return 1;
+	}
+
+	const uint32 entryCount = manifest.GetEntryCount();
+	const AssetManifestEntry* entries = manifest.GetEntries();
+	std::vector<std::unique_ptr<Texture>> looseTextures(entryCount);
+	const char* passNames[] = { "cold", "warm" };
+	uint64 looseChecksum = 0;
+	uint64 packChecksum = 0;
+	uint32 mismatchCount = 0;
+
+	std::printf("%u textures of %ux%u, pack size %llu KB\n", entryCount, textureSize, textureSize,
+		static_cast<unsigned long long>(std::filesystem::file_size(packPath, errorCode) / 1024));
+
+	// The files were just written, so they are evicted from the page cache before the cold pass
+	// instead of letting it measure the same warm reads as the second pass.
+	uint32 evictedCount = Platform::EvictFileCache(packPath) ? 1 : 0;
+
+	for (uint32 i = 0; i < entryCount; ++i)
+	{
+		evictedCount += Platform::EvictFileCache(manifest.GetFilePath(entries[i])) ? 1 : 0;
+	}
+
+	if (evictedCount != entryCount + 1)
+	{
+		std::printf("evicted %u of %u files from the page cache, the cold pass is partly warm\n",
+			evictedCount, entryCount + 1);
+	}
+
+	for (uint32 pass = 0; pass < 2; ++pass)
+	{
+		std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+		for (uint32 i = 0; i < entryCount; ++i)
+		{
+			looseTextures[i] = std::make_unique<Texture>();
+
+			if (looseTextures[i]->LoadImageFromFile(manifest.GetFilePath(entries[i])) && looseTextures[i]->GenerateMips())
+			{
+				looseChecksum += TouchTexture(*looseTextures[i]);
+			}
+		}
+
+		std::chrono::duration<float, std::milli> looseTime = std::chrono::steady_clock::now() - startTime;
+		startTime = std::chrono::steady_clock::now();
+
+		AssetPack pack;
+		const bool isOpen = pack.Open(packPath);
+		std::chrono::duration<float, std::milli> openTime = std::chrono::steady_clock::now() - startTime;
+		uint32 packedCount = 0;
+
+		for (uint32 i = 0; isOpen && i < entryCount; ++i)
+		{
+			const AssetPackEntry* entry = pack.Find(manifest.GetKey(entries[i]));
+			Texture texture;
+
+			if (entry == nullptr || entry->_contentHash != entries[i]._contentHash ||
+				!texture.SetMappedImage(pack.GetData(*entry), entry->_dataSize, entry->_format,
+					entry->_width, entry->_height, entry->_mipLevels))
+			{
+				continue;
+			}
+
+			packChecksum += TouchTexture(texture);
+			packedCount++;
+
+			if (pass == 0)
+			{
+				const Texture& looseTexture = *looseTextures[i];
+				const bool isSame = texture.GetImageSize() == looseTexture.GetImageSize() &&
+					texture.GetMipChainSize() == looseTexture.GetMipChainSize() &&
+					std::memcmp(texture.GetPixels(), looseTexture.GetPixels(), texture.GetImageSize()) == 0 &&
+					std::memcmp(texture.GetMipPixels(), looseTexture.GetMipPixels(), texture.GetMipChainSize()) == 0;
+
+				mismatchCount += isSame ? 0 : 1;
+			}
+		}
+
+		std::chrono::duration<float, std::milli> packTime = std::chrono::steady_clock::now() - startTime;
+		mismatchCount += entryCount - packedCount;
+
+		std::printf("%-8s pass: loose %9.2f ms (%7.3f ms/texture), pack %9.2f ms (%7.3f ms/texture, open %.3f ms)\n",
+			passNames[pass], looseTime.count(), looseTime.count() / MAX(1u, entryCount),
+			packTime.count(), packTime.count() / MAX(1u, entryCount), openTime.count());
+	}
+
+	std::printf("checksum loose %llu, pack %llu, %u mismatched\n",
+		static_cast<unsigned long long>(looseChecksum), static_cast<unsigned long long>(packChecksum), mismatchCount);
+
+	looseTextures.clear();
+	manifest.Close();
+	std::filesystem::remove_all(folderPath, errorCode);
+
+	return mismatchCount == 0 ? 0 : 1;
+}
+
+static int BuildVirtualTexture(const std::filesystem::path& sourcePath, ThreadPool* threadPool) noexcept
+{
+	const std::filesystem::path outputPath = std::filesystem::path(TextureManager::VIRTUAL_TEXTURE_PATH) /
+		(sourcePath.stem().string() + VirtualTextureFile::EXTENSION);
+
+	std::error_code errorCode;
+	std::filesystem::create_directories(outputPath.parent_path(), errorCode);
+
+	std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+	const bool isBuilt = VirtualTextureFile::Build(sourcePath, outputPath,
+		VirtualTextureFile::DEFAULT_TILE_SIZE, VirtualTextureFile::DEFAULT_BORDER, threadPool);
+	std::chrono::duration<float, std::milli> buildTime = std::chrono::steady_clock::now() - startTime;
+
+	VirtualTextureFile file;
+
+	if (!isBuilt || !file.Open(outputPath))
+	{
+		std::printf("failed to build %s\n", outputPath.string().c_str());
+		return 1;
+	}
+
+	std::printf("%s: %ux%u, %u mips, %u tiles of %u texels, %.2f ms\n", outputPath.string().c_str(),
+		file.GetWidth(), file.GetHeight(), file.GetMipLevels(), file.GetTileCount(), file.GetTileSize(), buildTime.count());
+
+	return 0;
+}
+
+static int SimulateVirtualTexture(const std::filesystem::path& filePath) noexcept
+{
+	VirtualTexture virtualTexture;
+
+	if (!virtualTexture.Open(nullptr, filePath))
+	{
+		std::printf("failed to open %s\n", filePath.string().c_str());
+		return 1;
+	}
+
+	const VirtualTextureFile& file = virtualTexture.GetFile();
+	Texture* physicalTexture = virtualTexture.GetPhysicalTexture();
+	const uint32 physicalSize = physicalTexture->GetWidth();
+	const uint32 frameCount = 600;
+	const float viewportWidth = 1280.0f;
+	const float aspectRatio = static_cast<float>(file.GetWidth()) / file.GetHeight();
+
+	std::vector<VirtualTileUpload> uploads;
+	uint64 uploadedBytes = 0;
+	uint32 uploadedCount = 0;
+	uint32 evictedCount = 0;
+	uint32 fallbackCount = 0;
+	uint32 drawCount = 0;
+	uint32 mismatchCount = 0;
+
+	for (uint32 frame = 1; frame <= frameCount; ++frame)
+	{
+		const float t = static_cast<float>(frame) / frameCount;
+		const float viewWidth = 0.05f + 0.95f * (0.5f + 0.5f * std::cos(t * 6.2831853f));
+		const float viewHeight = MIN(1.0f, viewWidth * aspectRatio * 9.0f / 16.0f);
+		const float centerX = viewWidth * 0.5f + (1.0f - viewWidth) * t;
+		const float centerY = viewHeight * 0.5f + (1.0f - viewHeight) * (0.5f + 0.5f * std::sin(t * 12.566371f));
+		const Vector4 uvRect(centerX - viewWidth * 0.5f, centerY - viewHeight * 0.5f,
+			centerX + viewWidth * 0.5f, centerY + viewHeight * 0.5f);
+		const uint32 mip = virtualTexture.SelectMip(file.GetWidth() * viewWidth / viewportWidth);
+
+		virtualTexture.BeginFrame(frame);
+		virtualTexture.Request(uvRect, mip);
+		virtualTexture.Update();
+		virtualTexture.TakeUploads(uploads);
+
+		for (const VirtualTileUpload& upload : uploads)
+		{
+			physicalTexture->UpdateRegion(nullptr, upload._x, upload._y, file.GetPageSize(), file.GetPageSize(),
+				file.GetTileData(upload._tileIndex));
+		}
+
+		uint32 x0, y0, x1, y1;
+		virtualTexture.GetTileRange(uvRect, mip, x0, y0, x1, y1);
+
+		for (uint32 y = y0; y <= y1; ++y)
+		{
+			for (uint32 x = x0; x <= x1; ++x)
+			{
+				Vector4 tileUvRect;
+
+				if (!virtualTexture.Resolve(mip, x, y, tileUvRect))
+				{
+					mismatchCount++;
+					continue;
+				}
+
+				drawCount++;
+
+				if (!virtualTexture.IsResident(mip, x, y))
+				{
+					continue;
+				}
+
+				const uint32 pageX = static_cast<uint32>(std::lround(tileUvRect.x * physicalSize));
+				const uint32 pageY = static_cast<uint32>(std::lround(tileUvRect.y * physicalSize));
+				const uint8* physicalRow = physicalTexture->GetPixels() + (static_cast<size_t>(pageY) * physicalSize + pageX) * 4;
+				const uint8* tileRow = file.GetTileData(file.GetTileIndex(mip, x, y)) +
+					(static_cast<size_t>(file.GetBorder()) * file.GetPageSize() + file.GetBorder()) * 4;
+
+				if (std::memcmp(physicalRow, tileRow, static_cast<size_t>(file.GetTileSize()) * 4) != 0)
+				{
+					mismatchCount++;
+				}
+			}
+		}
+
+		const VirtualTextureStats& stats = virtualTexture.GetStats();
+		uploadedBytes += stats._uploadedBytes;
+		uploadedCount += stats._uploadedCount;
+		evictedCount += stats._evictedCount;
+		fallbackCount += stats._fallbackCount;
+	}
+
+	std::printf("%u frames over %ux%u (%u tiles, %u slots): %u tiles drawn, %u fallback, %u uploaded (%llu KB), %u evicted, %u mismatched\n",
+		frameCount, file.GetWidth(), file.GetHeight(), file.GetTileCount(), virtualTexture.GetStats()._slotCount,
+		drawCount, fallbackCount, uploadedCount, static_cast<unsigned long long>(uploadedBytes / 1024), evictedCount, mismatchCount);
+
+	return mismatchCount == 0 ? 0 : 1;
+}
+
+static int ValidateManifest(const std::filesystem::path& resourcePath) noexcept
+{
+	const std::filesystem::path manifestPath = resourcePath / std::filesystem::path(TextureManager::MANIFEST_PATH).filename();
+
+	AssetManifest manifest;
+	std::vector<std::string> staleKeys;
+
+	std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+	const bool isOpen = manifest.Open(manifestPath);
+	const bool isValid = isOpen && manifest.Validate(resourcePath, staleKeys);
+	std::chrono::duration<float, std::milli> validateTime = std::chrono::steady_clock::now() - startTime;
+
+	for (const std::string& key : staleKeys)
+	{
+		std::printf("stale: %s\n", key.c_str());
+	}
+
+	std::printf("manifest %s: %s, %u entries, %u stale, %.2f ms\n", manifestPath.string().c_str(),
+		!isOpen ? "missing" : isValid ? "up to date" : "out of date, run the Cooker",
+		manifest.GetEntryCount(), static_cast<uint32>(staleKeys.size()), validateTime.count());
+
+	return isValid ? 0 : 1;
+}
+
+int main(int argc, char* argv[])
+{
+	std::filesystem::path resourcePath = TextureManager::RESOURCE_PATH;
+	bool isCompressionEnabled = false;
+	bool isValidateOnly = false;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--benchmark-resize") == 0)
+		{
+			return BenchmarkResize();
+		}
+		else if (std::strcmp(argv[i], "--benchmark-load") == 0)
+		{
+			return BenchmarkLoad(std::filesystem::path(AssetCooker::CACHE_PATH) / "LoadBenchmark");
+		}
+		else if (std::strcmp(argv[i], "--benchmark-pack") == 0)
+		{
+			return BenchmarkPack(std::filesystem::path(AssetCooker::CACHE_PATH) / "PackBenchmark");
+		}
+		else if (std::strcmp(argv[i], "--benchmark-sort") == 0)
+		{
+			return BenchmarkSort();
+		}
+		else if ((std::strcmp(argv[i], "--golden-render") == 0 || std::strcmp(argv[i], "--update-golden-render") == 0) && i + 1 < argc)
+		{
+			return RenderGolden(std::filesystem::u8path(argv[i + 1]), std::strcmp(argv[i], "--update-golden-render") == 0);
+		}
+		else if (std::strcmp(argv[i], "--benchmark-io") == 0)
+		{
+			return BenchmarkIO(std::filesystem::path(AssetCooker::CACHE_PATH) / "IoBenchmark");
+		}
+		else if (std::strcmp(argv[i], "--virtual-texture") == 0 && i + 1 < argc)
+		{
+			ThreadPool threadPool;
+			return BuildVirtualTexture(std::filesystem::u8path(argv[i + 1]), &threadPool);
+		}
+		else if (std::strcmp(argv[i], "--simulate-virtual-texture") == 0 && i + 1 < argc)
+		{
+			return SimulateVirtualTexture(std::filesystem::u8path(argv[i + 1]));
+		}
+		else if (std::strcmp(argv[i], "--compress") == 0)
+		{
+			isCompressionEnabled = true;
+		}
+		else if (std::strcmp(argv[i], "--validate") == 0)
+		{
+			isValidateOnly = true;
+		}
+		else
+		{
+			resourcePath = std::filesystem::u8path(argv[i]);
+		}
+	}
+
+	if (isValidateOnly)
+	{
+		return ValidateManifest(resourcePath);
+	}
+
+	ThreadPool threadPool;
+	AssetCooker cooker(&threadPool);
+	cooker.SetCompressionEnabled(isCompressionEnabled);
+
+	bool isCooked = cooker.Cook(resourcePath,
+		resourcePath / std::filesystem::path(TextureManager::MANIFEST_PATH).filename(),
+		resourcePath / std::filesystem::path(TextureManager::PACK_PATH).filename(),
+		AssetCooker::CACHE_PATH);
+
+	const CookStats& stats = cooker.GetStats();
+	std::printf("%u assets on %u threads: %u cooked, %u reused, %u failed\n",
+		stats._assetCount, stats._threadCount, stats._cookedCount, stats._reusedCount, stats._failedCount);
+	std::printf("scan %.2f ms, cook %.2f ms, pack %.2f ms%s, total %.2f ms, pack size %llu KB\n",
+		stats._scanTime, stats._cookTime, stats._packTime, stats._isPackUpToDate ? " (up to date)" : "",
+		stats._totalTime, static_cast<unsigned long long>(stats._packSize / 1024));
+
+	return isCooked ? 0 : 1;
+}
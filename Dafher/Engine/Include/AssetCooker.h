@@ -0,0 +1,100 @@
+#ifndef __ASSET_COOKER_H__
+#define __ASSET_COOKER_H__
+
+#include "Stdafx.h"
+#include "TextureCompressor.h"
+
+struct CookedAssetHeader
+{
+	uint32 _magic;
+	uint32 _version;
+	uint64 _cookKey;
+	uint32 _width;
+	uint32 _height;
+	uint32 _mipLevels;
+	BlockFormat _format;
+	uint64 _dataSize;
+};
+
+enum class CookResult : uint8
+{
+	Failed,
+	Reused,
+	Cooked
+};
+
+struct CookStats
+{
+	uint32 _assetCount;
+	uint32 _cookedCount;
+	uint32 _reusedCount;
+	uint32 _failedCount;
+	uint32 _threadCount;
+	uint64 _packSize;
+	float _scanTime;
+	float _cookTime;
+	float _packTime;
+	float _totalTime;
+	bool _isPackUpToDate;
+};
+
+class AssetCooker
+{
+public:
+	inline AssetCooker(class ThreadPool* threadPool) noexcept
+		: _threadPool(threadPool)
+		, _stats()
+		, _isCompressionEnabled(false)
+	{
+	}
+
+	AssetCooker(const AssetCooker& assetCooker) noexcept = delete;
+	AssetCooker(AssetCooker&& assetCooker) noexcept = delete;
+	AssetCooker& operator=(const AssetCooker& assetCooker) noexcept = delete;
+	AssetCooker& operator=(AssetCooker&& assetCooker) noexcept = delete;
+
+public:
+	~AssetCooker() noexcept = default;
+
+public:
+	bool Cook(const std::filesystem::path& resourcePath, const std::filesystem::path& manifestPath,
+		const std::filesystem::path& packPath, const std::filesystem::path& cachePath) noexcept;
+
+	static std::filesystem::path GetCookedPath(const std::filesystem::path& cachePath, uint64 cookKey) noexcept;
+
+public:
+	inline void SetCompressionEnabled(bool isCompressionEnabled) noexcept
+	{
+		_isCompressionEnabled = isCompressionEnabled;
+	}
+
+	inline bool IsCompressionEnabled() const noexcept
+	{
+		return _isCompressionEnabled;
+	}
+
+	inline const CookStats& GetStats() const noexcept
+	{
+		return _stats;
+	}
+
+public:
+	constexpr static uint32 COOKED_MAGIC = 0x4B434144;
+	constexpr static uint32 COOKED_VERSION = 1;
+	constexpr static const char* CACHE_PATH = "../Cache/Cooked/";
+
+private:
+	CookResult CookAsset(const std::filesystem::path& sourcePath, const std::filesystem::path& cookedPath,
+		uint64 cookKey, CookedAssetHeader& header) const noexcept;
+	uint64 GetCookKey(uint64 contentHash) const noexcept;
+	bool IsPackUpToDate(const std::filesystem::path& packPath, const std::vector<struct AssetPackSource>& sources) const noexcept;
+
+	static bool ReadCookedHeader(const std::filesystem::path& cookedPath, uint64 cookKey, CookedAssetHeader& header) noexcept;
+
+private:
+	class ThreadPool* _threadPool;
+	CookStats _stats;
+	bool _isCompressionEnabled;
+};
+
+#endif
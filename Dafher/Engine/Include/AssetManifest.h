@@ -0,0 +1,110 @@
+#ifndef __ASSET_MANIFEST_H__
+#define __ASSET_MANIFEST_H__
+
+#include "Stdafx.h"
+#include "MappedFile.h"
+
+enum class AssetFormat : uint32
+{
+	Unknown,
+	Png,
+	Jpeg,
+	Bmp,
+	Tga,
+	Dds
+};
+
+struct AssetManifestHeader
+{
+	uint32 _magic;
+	uint32 _version;
+	uint32 _entryCount;
+	uint32 _stringTableSize;
+};
+
+struct AssetManifestEntry
+{
+	uint64 _keyHash;
+	uint64 _contentHash;
+	uint64 _fileSize;
+	uint64 _writeTime;
+	uint32 _keyOffset;
+	uint32 _keyLength;
+	uint32 _pathOffset;
+	uint32 _pathLength;
+	uint32 _width;
+	uint32 _height;
+	AssetFormat _format;
+	uint32 _reserved;
+};
+
+class AssetManifest
+{
+public:
+	inline AssetManifest() noexcept
+		: _header(nullptr)
+		, _entries(nullptr)
+		, _strings(nullptr)
+	{
+	}
+
+	AssetManifest(const AssetManifest& manifest) noexcept = delete;
+	AssetManifest(AssetManifest&& manifest) noexcept = delete;
+	AssetManifest& operator=(const AssetManifest& manifest) noexcept = delete;
+	AssetManifest& operator=(AssetManifest&& manifest) noexcept = delete;
+
+public:
+	~AssetManifest() noexcept = default;
+
+public:
+	bool Open(const std::filesystem::path& manifestPath) noexcept;
+	void Close() noexcept;
+	const AssetManifestEntry* Find(std::string_view key) const noexcept;
+	std::filesystem::path GetFilePath(const AssetManifestEntry& entry) const noexcept;
+	bool Validate(const std::filesystem::path& folderPath, std::vector<std::string>& staleKeys) const noexcept;
+
+	static bool Build(const std::filesystem::path& folderPath, const std::filesystem::path& manifestPath,
+		class ThreadPool* threadPool = nullptr, const AssetManifest* previous = nullptr) noexcept;
+	static uint64 Hash(const void* data, size_t size) noexcept;
+	static AssetFormat GetFormat(const std::filesystem::path& filePath) noexcept;
+
+public:
+	inline bool IsOpen() const noexcept
+	{
+		return _header != nullptr;
+	}
+
+	inline uint32 GetEntryCount() const noexcept
+	{
+		return _header != nullptr ? _header->_entryCount : 0;
+	}
+
+	inline const AssetManifestEntry* GetEntries() const noexcept
+	{
+		return _entries;
+	}
+
+	inline std::string_view GetKey(const AssetManifestEntry& entry) const noexcept
+	{
+		return std::string_view(_strings + entry._keyOffset, entry._keyLength);
+	}
+
+	inline std::string_view GetRelativePath(const AssetManifestEntry& entry) const noexcept
+	{
+		return std::string_view(_strings + entry._pathOffset, entry._pathLength);
+	}
+
+public:
+	constexpr static uint32 MAGIC = 0x4D464144;
+	constexpr static uint32 VERSION = 2;
+
+private:
+	MappedFile _file;
+	std::filesystem::path _folderPath;
+
+	const AssetManifestHeader* _header;
+	const AssetManifestEntry* _entries;
+	const char* _strings;
+};
+
+#endif
@@ -0,0 +1,110 @@
+#ifndef __ASSET_PACK_H__
+#define __ASSET_PACK_H__
+
+#include "Stdafx.h"
+#include "MappedFile.h"
+#include "TextureCompressor.h"
+
+struct AssetPackHeader
+{
+	uint32 _magic;
+	uint32 _version;
+	uint32 _entryCount;
+	uint32 _stringTableSize;
+	uint64 _stringTableOffset;
+	uint64 _dataOffset;
+};
+
+struct AssetPackEntry
+{
+	uint64 _keyHash;
+	uint64 _contentHash;
+	uint64 _dataOffset;
+	uint64 _dataSize;
+	uint32 _keyOffset;
+	uint32 _keyLength;
+	uint32 _width;
+	uint32 _height;
+	uint32 _mipLevels;
+	BlockFormat _format;
+	uint64 _cookKey;
+};
+
+struct AssetPackSource
+{
+	std::string _key;
+	uint64 _contentHash;
+	uint64 _cookKey;
+	uint32 _width;
+	uint32 _height;
+	uint32 _mipLevels;
+	BlockFormat _format;
+	std::filesystem::path _payloadPath;
+	uint64 _payloadOffset;
+};
+
+class AssetPack
+{
+public:
+	inline AssetPack() noexcept
+		: _header(nullptr)
+		, _entries(nullptr)
+		, _strings(nullptr)
+	{
+	}
+
+	AssetPack(const AssetPack& pack) noexcept = delete;
+	AssetPack(AssetPack&& pack) noexcept = delete;
+	AssetPack& operator=(const AssetPack& pack) noexcept = delete;
+	AssetPack& operator=(AssetPack&& pack) noexcept = delete;
+
+public:
+	~AssetPack() noexcept = default;
+
+public:
+	bool Open(const std::filesystem::path& packPath) noexcept;
+	void Close() noexcept;
+	const AssetPackEntry* Find(std::string_view key) const noexcept;
+
+	static bool Write(const std::filesystem::path& packPath, const std::vector<AssetPackSource>& sources) noexcept;
+
+public:
+	inline bool IsOpen() const noexcept
+	{
+		return _header != nullptr;
+	}
+
+	inline uint32 GetEntryCount() const noexcept
+	{
+		return _header != nullptr ? _header->_entryCount : 0;
+	}
+
+	inline const AssetPackEntry* GetEntries() const noexcept
+	{
+		return _entries;
+	}
+
+	inline std::string_view GetKey(const AssetPackEntry& entry) const noexcept
+	{
+		return std::string_view(_strings + entry._keyOffset, entry._keyLength);
+	}
+
+	inline const uint8* GetData(const AssetPackEntry& entry) const noexcept
+	{
+		return _file.GetData() + entry._dataOffset;
+	}
+
+public:
+	constexpr static uint32 MAGIC = 0x4B504144;
+	constexpr static uint32 VERSION = 1;
+	constexpr static uint64 ALIGNMENT = 64;
+
+private:
+	MappedFile _file;
+
+	const AssetPackHeader* _header;
+	const AssetPackEntry* _entries;
+	const char* _strings;
+};
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef __BOUNDS_H__
+#define __BOUNDS_H__
+
+#include "Stdafx.h"
+
+struct Bounds
+{
+	inline Bounds() noexcept
+		: _min(std::numeric_limits<float>::max(), std::numeric_limits<float>::max())
+		, _max(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max())
+	{
+	}
+
+	inline Bounds(const Vector2& min, const Vector2& max) noexcept
+		: _min(min)
+		, _max(max)
+	{
+	}
+
+	inline bool IsValid() const noexcept
+	{
+		return _min.x <= _max.x && _min.y <= _max.y;
+	}
+
+	inline void Merge(const Bounds& bounds) noexcept
+	{
+		_min.x = MIN(_min.x, bounds._min.x);
+		_min.y = MIN(_min.y, bounds._min.y);
+		_max.x = MAX(_max.x, bounds._max.x);
+		_max.y = MAX(_max.y, bounds._max.y);
+	}
+
+	inline void Merge(const Vector2& point) noexcept
+	{
+		_min.x = MIN(_min.x, point.x);
+		_min.y = MIN(_min.y, point.y);
+		_max.x = MAX(_max.x, point.x);
+		_max.y = MAX(_max.y, point.y);
+	}
+
+	inline bool Intersects(const Bounds& bounds) const noexcept
+	{
+		return _min.x <= bounds._max.x && bounds._min.x <= _max.x &&
+			_min.y <= bounds._max.y && bounds._min.y <= _max.y;
+	}
+
+	static inline Bounds FromQuad(float originX, float originY,
+		float axisXX, float axisXY, float axisYX, float axisYY) noexcept
+	{
+		return Bounds(
+			Vector2(originX + MIN(0.0f, axisXX) + MIN(0.0f, axisYX),
+				originY + MIN(0.0f, axisXY) + MIN(0.0f, axisYY)),
+			Vector2(originX + MAX(0.0f, axisXX) + MAX(0.0f, axisYX),
+				originY + MAX(0.0f, axisXY) + MAX(0.0f, axisYY))
+		);
+	}
+
+	static inline Bounds FromQuad(const InstanceData& instance) noexcept
+	{
+		return FromQuad(instance._translation.x, instance._translation.y,
+			instance._axes.x, instance._axes.y, instance._axes.z, instance._axes.w);
+	}
+
+	static inline Bounds FromQuad(const Matrix& worldMatrix) noexcept
+	{
+		return FromQuad(worldMatrix._41, worldMatrix._42,
+			worldMatrix._11, worldMatrix._12, worldMatrix._21, worldMatrix._22);
+	}
+
+	Vector2 _min;
+	Vector2 _max;
+};
+
+#endif
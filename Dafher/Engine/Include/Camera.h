@@ -0,0 +1,97 @@
+#ifndef __CAMERA_H__
+#define __CAMERA_H__
+
+#include "Component.h"
+
+class Camera : public Component
+{
+protected:
+	inline Camera() noexcept
+		: Component()
+		, _viewMatrix(DirectX::XMMatrixIdentity())
+		, _projectionMatrix(DirectX::XMMatrixIdentity())
+		, _viewProjectionMatrix(DirectX::XMMatrixIdentity())
+		, _viewport(0.0f, 0.0f, 1.0f, 1.0f)
+		, _screenSize(Vector2::Zero)
+		, _zoom(1.0f)
+		, _distance(10.0f)
+		, _nearPlane(0.0f)
+		, _farPlane(1000.0f)
+		, _depth(0)
+		, _cachedWorldVersion(0)
+		, _isViewDirty(true)
+		, _isProjectionDirty(true)
+	{
+	}
+
+	Camera(const Camera& camera) noexcept = delete;
+	Camera(Camera&& camera) noexcept = delete;
+	Camera& operator=(const Camera& camera) noexcept = delete;
+	Camera& operator=(Camera&& camera) noexcept = delete;
+
+public:
+	virtual ~Camera() noexcept override;
+
+public:
+	CREATE(Camera)
+
+public:
+	virtual bool Init() override;
+
+	void SetViewport(float x, float y, float width, float height) noexcept;
+	void SetZoom(float zoom) noexcept;
+	void SetClipPlanes(float nearPlane, float farPlane) noexcept;
+
+	const Matrix& GetViewMatrix() const noexcept;
+	const Matrix& GetProjectionMatrix() const noexcept;
+	const Matrix& GetViewProjectionMatrix() const noexcept;
+	const Bounds& GetViewBounds() const noexcept;
+	Vector4 GetPixelViewport() const noexcept;
+
+public:
+	inline const Vector4& GetViewport() const noexcept
+	{
+		return _viewport;
+	}
+
+	inline float GetZoom() const noexcept
+	{
+		return _zoom;
+	}
+
+	inline void SetDepth(int32 depth) noexcept
+	{
+		_depth = depth;
+	}
+
+	inline int32 GetDepth() const noexcept
+	{
+		return _depth;
+	}
+
+private:
+	void UpdateViewMatrix() const noexcept;
+	void UpdateProjectionMatrix() const noexcept;
+	void Refresh() const noexcept;
+
+private:
+	mutable Matrix _viewMatrix;
+	mutable Matrix _projectionMatrix;
+	mutable Matrix _viewProjectionMatrix;
+	mutable Bounds _viewBounds;
+
+	Vector4 _viewport;
+	mutable Vector2 _screenSize;
+
+	float _zoom;
+	float _distance;
+	float _nearPlane;
+	float _farPlane;
+	int32 _depth;
+
+	mutable uint32 _cachedWorldVersion;
+	mutable bool _isViewDirty;
+	mutable bool _isProjectionDirty;
+};
+
+#endif
@@ -2,6 +2,7 @@
 #define __COMPONENT_H__
 
 #include "Stdafx.h"
+#include "Bounds.h"
 
 class Node;
 
@@ -27,6 +28,7 @@ public:
 	virtual void PreUpdate(float deltaTime) {}
 	virtual void Update(float deltaTime) {}
 	virtual void PostUpdate(float deltaTime) {}
+	virtual bool GetWorldBounds(Bounds& bounds) const { return false; }
 
 public:
 	inline void SetEnabled(bool enabled) noexcept
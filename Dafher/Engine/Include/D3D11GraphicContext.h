@@ -0,0 +1,112 @@
+#ifndef __D3D11_GRAPHIC_CONTEXT_H__
+#define __D3D11_GRAPHIC_CONTEXT_H__
+
+#include "GraphicContext.h"
+
+#ifdef _WIN32
+
+class D3D11GraphicTexture : public GraphicTexture
+{
+public:
+	inline D3D11GraphicTexture(ComPtr<ID3D11Texture2D>&& texture2D, ComPtr<ID3D11ShaderResourceView>&& shaderResourceView) noexcept
+		: _texture2D(std::move(texture2D))
+		, _shaderResourceView(std::move(shaderResourceView))
+	{
+	}
+
+	D3D11GraphicTexture(const D3D11GraphicTexture& graphicTexture) noexcept = delete;
+	D3D11GraphicTexture(D3D11GraphicTexture&& graphicTexture) noexcept = delete;
+	D3D11GraphicTexture& operator=(const D3D11GraphicTexture& graphicTexture) noexcept = delete;
+	D3D11GraphicTexture& operator=(D3D11GraphicTexture&& graphicTexture) noexcept = delete;
+
+public:
+	virtual ~D3D11GraphicTexture() noexcept override = default;
+
+public:
+	inline ID3D11Texture2D* GetTexture2D() const noexcept
+	{
+		return _texture2D.Get();
+	}
+
+	inline ID3D11ShaderResourceView* GetShaderResourceView() const noexcept
+	{
+		return _shaderResourceView.Get();
+	}
+
+private:
+	ComPtr<ID3D11Texture2D> _texture2D;
+	ComPtr<ID3D11ShaderResourceView> _shaderResourceView;
+};
+
+class D3D11GraphicContext : public GraphicContext
+{
+public:
+	inline D3D11GraphicContext(const ComPtr<ID3D11Device>& device, const ComPtr<ID3D11DeviceContext>& deviceContext) noexcept
+		: _device(device)
+		, _deviceContext(deviceContext)
+	{
+	}
+
+	D3D11GraphicContext(const D3D11GraphicContext& graphicContext) noexcept = delete;
+	D3D11GraphicContext(D3D11GraphicContext&& graphicContext) noexcept = delete;
+	D3D11GraphicContext& operator=(const D3D11GraphicContext& graphicContext) noexcept = delete;
+	D3D11GraphicContext& operator=(D3D11GraphicContext&& graphicContext) noexcept = delete;
+
+public:
+	virtual ~D3D11GraphicContext() noexcept override = default;
+
+public:
+	virtual bool CreateResources(uint32 maxQuads, uint32 maxInstances) noexcept override;
+	virtual std::unique_ptr<GraphicTexture> CreateTexture(const class Texture& texture) noexcept override;
+	virtual void SetViewport(const Vector4& viewport) noexcept override;
+	virtual void UpdateBuffer(GraphicBuffer buffer, const void* data, size_t dataSize) noexcept override;
+	virtual void UpdateTexture(class Texture* texture,
+		uint32 x, uint32 y, uint32 width, uint32 height, const uint8* data) noexcept override;
+
+	virtual void SetRasterizerState() noexcept override;
+	virtual void SetBlendState(BlendMode blendMode) noexcept override;
+	virtual void SetVertexShader(GraphicShader shader) noexcept override;
+	virtual void SetPixelShader(GraphicShader shader) noexcept override;
+	virtual void SetInputLayout(GraphicInputLayout inputLayout) noexcept override;
+	virtual void SetConstantBuffer(GraphicBuffer buffer) noexcept override;
+	virtual void SetSampler() noexcept override;
+	virtual void SetTopology() noexcept override;
+	virtual void SetVertexBuffer(uint32 slot, GraphicBuffer buffer, uint32 stride) noexcept override;
+	virtual void SetIndexBuffer(GraphicBuffer buffer) noexcept override;
+	virtual void SetTexture(const class Texture* texture) noexcept override;
+
+	virtual void DrawIndexed(uint32 indexCount, uint32 firstIndex) noexcept override;
+	virtual void DrawIndexedInstanced(uint32 indexCount, uint32 instanceCount, uint32 firstInstance) noexcept override;
+
+	virtual uint64 GetTextureBinding(const class Texture* texture) const noexcept override;
+
+private:
+	bool CreateBatchShaders() noexcept;
+	bool CreateInstanceShaders() noexcept;
+	bool CreateBuffers() noexcept;
+	bool CreateBatchBuffers(uint32 maxQuads) noexcept;
+	bool CreateInstanceBuffers(uint32 maxInstances) noexcept;
+	bool CreateStates() noexcept;
+
+	inline ID3D11Buffer* GetBuffer(GraphicBuffer buffer) const noexcept
+	{
+		return _buffers[static_cast<size_t>(buffer)].Get();
+	}
+
+private:
+	ComPtr<ID3D11Device> _device;
+	ComPtr<ID3D11DeviceContext> _deviceContext;
+
+	std::array<ComPtr<ID3D11VertexShader>, static_cast<size_t>(GraphicShader::Count)> _vertexShaders;
+	std::array<ComPtr<ID3D11PixelShader>, static_cast<size_t>(GraphicShader::Count)> _pixelShaders;
+	std::array<ComPtr<ID3D11InputLayout>, static_cast<size_t>(GraphicInputLayout::Count)> _inputLayouts;
+	std::array<ComPtr<ID3D11Buffer>, static_cast<size_t>(GraphicBuffer::Count)> _buffers;
+
+	ComPtr<ID3D11RasterizerState> _rasterizerState;
+	ComPtr<ID3D11SamplerState> _samplerState;
+	std::array<ComPtr<ID3D11BlendState>, static_cast<size_t>(BlendMode::Count)> _blendStates;
+};
+
+#endif
+
+#endif
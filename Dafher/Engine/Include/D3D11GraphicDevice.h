@@ -0,0 +1,58 @@
+#ifndef __D3D11_GRAPHIC_DEVICE_H__
+#define __D3D11_GRAPHIC_DEVICE_H__
+
+#include "GraphicDevice.h"
+#include "D3D11GraphicContext.h"
+
+#ifdef _WIN32
+
+class D3D11GraphicDevice : public GraphicDevice
+{
+public:
+	inline D3D11GraphicDevice() noexcept
+		: GraphicDevice()
+	{
+	}
+
+	D3D11GraphicDevice(const D3D11GraphicDevice& graphicDevice) = delete;
+	D3D11GraphicDevice(D3D11GraphicDevice&& graphicDevice) noexcept = delete;
+	D3D11GraphicDevice& operator=(const D3D11GraphicDevice& graphicDevice) = delete;
+	D3D11GraphicDevice& operator=(D3D11GraphicDevice&& graphicDevice) = delete;
+
+public:
+	virtual ~D3D11GraphicDevice() noexcept override = default;
+
+public:
+	virtual bool Init(class Window* window) noexcept override;
+	virtual void BeginFrame() noexcept override;
+	virtual void EndFrame() noexcept override;
+	virtual void Clear() noexcept override;
+	virtual class GraphicContext* GetContext() const noexcept override;
+
+public:
+	inline ComPtr<ID3D11Device> GetD11Device() const noexcept
+	{
+		return _device;
+	}
+
+	inline ComPtr<IDXGISwapChain> GetSwapChain() const noexcept
+	{
+		return _swapChain;
+	}
+
+	inline ComPtr<ID3D11DeviceContext> GetD11Context() const noexcept
+	{
+		return _context;
+	}
+
+private:
+	ComPtr<ID3D11Device> _device;
+	ComPtr<ID3D11DeviceContext> _context;
+	ComPtr<IDXGISwapChain> _swapChain;
+	ComPtr<ID3D11RenderTargetView> _renderTargetView;
+	std::unique_ptr<D3D11GraphicContext> _graphicContext;
+};
+
+#endif
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef __DDS_FILE_H__
+#define __DDS_FILE_H__
+
+#include "Stdafx.h"
+#include "TextureCompressor.h"
+
+struct DdsImage
+{
+	const uint8* _data;
+	size_t _dataSize;
+	BlockFormat _format;
+	uint32 _width;
+	uint32 _height;
+	uint32 _mipLevels;
+	bool _isBgra;
+};
+
+class DdsFile
+{
+public:
+	DdsFile() noexcept = delete;
+
+public:
+	static bool IsDds(const void* data, size_t dataSize) noexcept;
+	static bool Parse(const void* data, size_t dataSize, DdsImage& image) noexcept;
+	static size_t GetLevelSize(BlockFormat format, uint32 width, uint32 height) noexcept;
+
+public:
+	constexpr static uint32 MAGIC = 0x20534444;
+	constexpr static uint32 HEADER_SIZE = 124;
+	constexpr static uint32 PIXEL_FORMAT_SIZE = 32;
+};
+
+#endif
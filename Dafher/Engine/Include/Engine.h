@@ -20,7 +20,7 @@ public:
 	static Engine* GetInstance() noexcept;
 
 public:
-	void Init() noexcept;
+	void Init(bool isHeadless = false) noexcept;
 	void PreUpdate() noexcept;
 	void Update() noexcept;
 	void PostUpdate() noexcept;
@@ -28,13 +28,30 @@ public:
 
 	void SetCurrentScene(class Scene* scene) noexcept;
 	void ChangeScene(class Scene* scene) noexcept;
+	void SetRenderThreadEnabled(bool isRenderThreadEnabled) noexcept;
+	void SetRenderSubmitter(std::unique_ptr<class RenderSubmitter> renderSubmitter) noexcept;
 
 public:
+	inline class Window* GetWindow() const noexcept
+	{
+		return _window.get();
+	}
+
 	inline class GraphicDevice* GetDevice() const noexcept
 	{
 		return _graphicDevice.get();
 	}
 
+	inline class ThreadPool* GetThreadPool() const noexcept
+	{
+		return _threadPool.get();
+	}
+
+	inline class FileIO* GetFileIO() const noexcept
+	{
+		return _fileIO.get();
+	}
+
 	inline class TextureManager* GetTextureManager() const noexcept
 	{
 		return _textureManager.get();
@@ -45,24 +62,41 @@ public:
 		return _renderer.get();
 	}
 
+	inline class RenderThread* GetRenderThread() const noexcept
+	{
+		return _renderThread.get();
+	}
+
 	inline float GetDeltaTime() const noexcept
 	{
 		return _deltaTime;
 	}
 
+	inline bool IsHeadless() const noexcept
+	{
+		return _isHeadless;
+	}
+
 private:
+	void InitD3D11() noexcept;
+	void InitHeadless() noexcept;
 	void CalculateDeltaTime() noexcept;
 
 private:
 	std::unique_ptr<class Window> _window;
 	std::unique_ptr<class GraphicDevice> _graphicDevice;
+	std::unique_ptr<class ThreadPool> _threadPool;
+	std::unique_ptr<class FileIO> _fileIO;
 	std::unique_ptr<class TextureManager> _textureManager;
 	std::unique_ptr<class Renderer> _renderer;
+	std::unique_ptr<class RenderThread> _renderThread;
+	std::unique_ptr<class RenderSubmitter> _renderSubmitter;
 	std::unique_ptr<class Scene> _currentScene;
 
 	std::chrono::steady_clock::time_point _lastFrameTime;
 	std::chrono::steady_clock::time_point _currentFrameTime;
 	float _deltaTime;
+	bool _isHeadless;
 };
 
 #endif
\ No newline at end of file
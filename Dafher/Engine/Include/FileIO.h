@@ -0,0 +1,186 @@
+#ifndef __FILE_IO_H__
+#define __FILE_IO_H__
+
+#include "Stdafx.h"
+#include "MappedFile.h"
+
+enum class IoPriority : uint8
+{
+	High,
+	Normal,
+	Low,
+	Count
+};
+
+enum class IoMode : uint8
+{
+	Auto,
+	Read,
+	Map
+};
+
+enum class IoStatus : uint8
+{
+	Completed,
+	Failed,
+	Cancelled
+};
+
+class IoBuffer
+{
+public:
+	inline IoBuffer() noexcept
+		: _size(0)
+	{
+	}
+
+	IoBuffer(const IoBuffer& ioBuffer) noexcept = delete;
+	IoBuffer(IoBuffer&& ioBuffer) noexcept = default;
+	IoBuffer& operator=(const IoBuffer& ioBuffer) noexcept = delete;
+	IoBuffer& operator=(IoBuffer&& ioBuffer) noexcept = default;
+
+public:
+	~IoBuffer() noexcept = default;
+
+public:
+	bool Load(const std::filesystem::path& filePath, IoMode mode = IoMode::Auto) noexcept;
+	bool Map(const std::filesystem::path& filePath) noexcept;
+	bool Read(const std::filesystem::path& filePath) noexcept;
+	uint8* Allocate(uint64 size) noexcept;
+	void Reset() noexcept;
+
+public:
+	inline const uint8* GetData() const noexcept
+	{
+		return _mappedFile != nullptr ? _mappedFile->GetData() : _data.data();
+	}
+
+	inline uint64 GetSize() const noexcept
+	{
+		return _size;
+	}
+
+	inline bool IsMapped() const noexcept
+	{
+		return _mappedFile != nullptr;
+	}
+
+	inline bool IsEmpty() const noexcept
+	{
+		return _size == 0;
+	}
+
+public:
+	constexpr static uint64 MAP_THRESHOLD = 1024 * 1024;
+
+private:
+	std::vector<uint8> _data;
+	std::unique_ptr<MappedFile> _mappedFile;
+	uint64 _size;
+};
+
+using IoCallback = std::function<void(IoStatus status, IoBuffer& buffer)>;
+
+struct IoRequest
+{
+	std::filesystem::path _filePath;
+	IoCallback _callback;
+	IoPriority _priority;
+	IoMode _mode;
+};
+
+struct IoStats
+{
+	uint32 _queueDepth;
+	uint32 _inFlightCount;
+	uint32 _completedCount;
+	uint32 _failedCount;
+	uint32 _cancelledCount;
+	uint32 _batchCount;
+	uint64 _readBytes;
+	uint64 _mappedBytes;
+	float _averageLatency;
+	float _maxLatency;
+	bool _isUringEnabled;
+};
+
+class FileIO
+{
+public:
+	FileIO(class ThreadPool* threadPool, bool isUringEnabled = true) noexcept;
+
+	FileIO(const FileIO& fileIO) noexcept = delete;
+	FileIO(FileIO&& fileIO) noexcept = delete;
+	FileIO& operator=(const FileIO& fileIO) noexcept = delete;
+	FileIO& operator=(FileIO&& fileIO) noexcept = delete;
+
+public:
+	~FileIO() noexcept;
+
+public:
+	uint64 Submit(IoRequest&& request) noexcept;
+	void SubmitBatch(std::vector<IoRequest>& requests, std::vector<uint64>* requestIds = nullptr) noexcept;
+	bool SetPriority(uint64 requestId, IoPriority priority) noexcept;
+	bool Cancel(uint64 requestId) noexcept;
+	void CancelAll() noexcept;
+	void Wait() noexcept;
+	IoStats GetStats() const noexcept;
+
+public:
+	inline bool IsUringEnabled() const noexcept
+	{
+		return _uring != nullptr;
+	}
+
+	inline uint32 GetMaxInFlight() const noexcept
+	{
+		return _maxInFlight;
+	}
+
+public:
+	constexpr static uint32 URING_QUEUE_DEPTH = 64;
+
+private:
+	struct ActiveRequest
+	{
+		IoRequest _request;
+		IoBuffer _buffer;
+		std::chrono::steady_clock::time_point _submitTime;
+		uint64 _id;
+		uint64 _offset;
+		int32 _descriptor;
+		bool _isStarted;
+		bool _isCancelled;
+	};
+
+	uint64 Enqueue(IoRequest&& request) noexcept;
+	void Dispatch() noexcept;
+	void Execute(ActiveRequest* active) noexcept;
+	void Finish(ActiveRequest* active, IoStatus status) noexcept;
+
+	bool StartUringRead(ActiveRequest* active) noexcept;
+	void SubmitUringRead(ActiveRequest* active) noexcept;
+	void ReapUring() noexcept;
+
+private:
+	class ThreadPool* _threadPool;
+	std::unique_ptr<struct UringQueue> _uring;
+	std::thread _reaperThread;
+
+	std::array<std::deque<uint64>, static_cast<size_t>(IoPriority::Count)> _queues;
+	std::unordered_map<uint64, std::unique_ptr<ActiveRequest>> _requests;
+
+	mutable std::mutex _mutex;
+	std::mutex _submitMutex;
+	std::condition_variable _idleCondition;
+
+	uint64 _nextRequestId;
+	uint64 _latencySampleCount;
+	uint32 _queuedCount;
+	uint32 _inFlightCount;
+	uint32 _finishingCount;
+	uint32 _maxInFlight;
+	IoStats _stats;
+};
+
+#endif
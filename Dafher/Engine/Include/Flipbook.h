@@ -0,0 +1,20 @@
+#ifndef __FLIPBOOK_H__
+#define __FLIPBOOK_H__
+
+#include "Stdafx.h"
+
+struct FlipbookFrame
+{
+	class Texture* _texture;
+	Vector4 _uvRect;
+};
+
+struct Flipbook
+{
+	std::vector<FlipbookFrame> _frames;
+	uint32 _frameWidth;
+	uint32 _frameHeight;
+	uint32 _pageCount;
+};
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef __GRAPHIC_CONTEXT_H__
+#define __GRAPHIC_CONTEXT_H__
+
+#include "Stdafx.h"
+#include "QuadBatch.h"
+
+enum class GraphicShader : uint32
+{
+	BatchVertex,
+	InstanceVertex,
+	SpritePixel,
+	Count
+};
+
+enum class GraphicInputLayout : uint32
+{
+	Batch,
+	Instance,
+	Count
+};
+
+enum class GraphicBuffer : uint32
+{
+	QuadVertex,
+	QuadIndex,
+	BatchVertex,
+	BatchIndex,
+	Instance,
+	ViewProjection,
+	Count
+};
+
+class GraphicTexture
+{
+public:
+	virtual ~GraphicTexture() noexcept = default;
+};
+
+class GraphicContext
+{
+public:
+	virtual ~GraphicContext() noexcept = default;
+
+public:
+	virtual bool CreateResources(uint32 maxQuads, uint32 maxInstances) noexcept = 0;
+	virtual std::unique_ptr<GraphicTexture> CreateTexture(const class Texture& texture) noexcept = 0;
+	virtual void SetViewport(const Vector4& viewport) noexcept = 0;
+	virtual void UpdateBuffer(GraphicBuffer buffer, const void* data, size_t dataSize) noexcept = 0;
+	virtual void UpdateTexture(class Texture* texture,
+		uint32 x, uint32 y, uint32 width, uint32 height, const uint8* data) noexcept = 0;
+
+	virtual void SetRasterizerState() noexcept = 0;
+	virtual void SetBlendState(BlendMode blendMode) noexcept = 0;
+	virtual void SetVertexShader(GraphicShader shader) noexcept = 0;
+	virtual void SetPixelShader(GraphicShader shader) noexcept = 0;
+	virtual void SetInputLayout(GraphicInputLayout inputLayout) noexcept = 0;
+	virtual void SetConstantBuffer(GraphicBuffer buffer) noexcept = 0;
+	virtual void SetSampler() noexcept = 0;
+	virtual void SetTopology() noexcept = 0;
+	virtual void SetVertexBuffer(uint32 slot, GraphicBuffer buffer, uint32 stride) noexcept = 0;
+	virtual void SetIndexBuffer(GraphicBuffer buffer) noexcept = 0;
+	virtual void SetTexture(const class Texture* texture) noexcept = 0;
+
+	virtual void DrawIndexed(uint32 indexCount, uint32 firstIndex) noexcept = 0;
+	virtual void DrawIndexedInstanced(uint32 indexCount, uint32 instanceCount, uint32 firstInstance) noexcept = 0;
+
+	virtual uint64 GetTextureBinding(const class Texture* texture) const noexcept = 0;
+};
+
+#endif
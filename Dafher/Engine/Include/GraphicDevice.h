@@ -7,7 +7,9 @@ class GraphicDevice
 {
 public:
 	inline GraphicDevice() noexcept
-		: _aspectRatio(0.0f)
+		: _width(0)
+		, _height(0)
+		, _aspectRatio(0.0f)
 	{
 	}
 
@@ -17,41 +19,42 @@ public:
 	GraphicDevice& operator=(GraphicDevice&& graphicDevice) = delete;
 
 public:
-	~GraphicDevice() noexcept = default;
+	virtual ~GraphicDevice() noexcept = default;
 
 public:
-	bool Init(HWND hWnd) noexcept;
-	void BeginFrame() noexcept;
-	void EndFrame() noexcept;
-	void Clear() noexcept;
+	virtual bool Init(class Window* window) noexcept = 0;
+	virtual void BeginFrame() noexcept = 0;
+	virtual void EndFrame() noexcept = 0;
+	virtual void Clear() noexcept = 0;
+	virtual class GraphicContext* GetContext() const noexcept = 0;
 
 public:
-	inline ComPtr<ID3D11Device> GetD11Device() const noexcept
+	inline uint32 GetWidth() const noexcept
 	{
-		return _device;
+		return _width;
 	}
 
-	inline ComPtr<IDXGISwapChain> GetSwapChain() const noexcept
+	inline uint32 GetHeight() const noexcept
 	{
-		return _swapChain;
+		return _height;
 	}
 
-	inline ComPtr<ID3D11DeviceContext> GetContext() const noexcept
+	inline float GetAspectRatio() const noexcept
 	{
-		return _context;
+		return _aspectRatio;
 	}
 
-	inline float GetAspectRatio() const noexcept
+protected:
+	inline void SetSize(uint32 width, uint32 height) noexcept
 	{
-		return _aspectRatio;
+		_width = width;
+		_height = height;
+		_aspectRatio = height > 0 ? static_cast<float>(width) / static_cast<float>(height) : 0.0f;
 	}
 
 private:
-	ComPtr<ID3D11Device> _device;
-	ComPtr<ID3D11DeviceContext> _context;
-	ComPtr<IDXGISwapChain> _swapChain;
-	ComPtr<ID3D11RenderTargetView> _renderTargetView;
-
+	uint32 _width;
+	uint32 _height;
 	float _aspectRatio;
 };
 
@@ -0,0 +1,67 @@
+#ifndef __HEADLESS_WINDOW_H__
+#define __HEADLESS_WINDOW_H__
+
+#include "Window.h"
+
+class HeadlessWindow : public Window
+{
+public:
+	inline HeadlessWindow(uint32 width = DEFAULT_WIDTH, uint32 height = DEFAULT_HEIGHT) noexcept
+		: _width(width)
+		, _height(height)
+		, _isCloseRequested(false)
+	{
+	}
+
+	HeadlessWindow(const HeadlessWindow& window) noexcept = delete;
+	HeadlessWindow(HeadlessWindow&& window) noexcept = delete;
+	HeadlessWindow& operator=(const HeadlessWindow& window) noexcept = delete;
+	HeadlessWindow& operator=(HeadlessWindow&& window) noexcept = delete;
+
+public:
+	virtual ~HeadlessWindow() noexcept override = default;
+
+public:
+	virtual bool Init() noexcept override
+	{
+		_isCloseRequested = false;
+
+		return true;
+	}
+
+	virtual bool ProcessEvents() noexcept override
+	{
+		return !_isCloseRequested;
+	}
+
+	virtual void* GetNativeHandle() const noexcept override
+	{
+		return nullptr;
+	}
+
+	virtual uint32 GetWidth() const noexcept override
+	{
+		return _width;
+	}
+
+	virtual uint32 GetHeight() const noexcept override
+	{
+		return _height;
+	}
+
+	inline void RequestClose() noexcept
+	{
+		_isCloseRequested = true;
+	}
+
+public:
+	constexpr static uint32 DEFAULT_WIDTH = 1280;
+	constexpr static uint32 DEFAULT_HEIGHT = 720;
+
+private:
+	uint32 _width;
+	uint32 _height;
+	bool _isCloseRequested;
+};
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef __IMAGE_RESIZER_H__
+#define __IMAGE_RESIZER_H__
+
+#include "Stdafx.h"
+
+class ImageResizer
+{
+public:
+	ImageResizer() noexcept = delete;
+
+public:
+	static bool Resize(const uint8* inputData, uint32 inputWidth, uint32 inputHeight,
+		uint8* outputData, uint32 outputWidth, uint32 outputHeight, class ThreadPool* threadPool = nullptr) noexcept;
+
+public:
+	constexpr static uint64 MIN_SPLIT_PIXELS = 256 * 256;
+};
+
+#endif
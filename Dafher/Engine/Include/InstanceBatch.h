@@ -0,0 +1,75 @@
+#ifndef __INSTANCE_BATCH_H__
+#define __INSTANCE_BATCH_H__
+
+#include "QuadBatch.h"
+
+class InstanceBackend
+{
+public:
+	virtual ~InstanceBackend() noexcept = default;
+
+public:
+	virtual void Flush(const InstanceData* instances, uint32 instanceCount,
+		const BatchRange* ranges, uint32 rangeCount) noexcept = 0;
+};
+
+class InstanceBatch
+{
+public:
+	InstanceBatch(uint32 maxInstances = DEFAULT_MAX_INSTANCES) noexcept;
+
+	InstanceBatch(const InstanceBatch& instanceBatch) noexcept = delete;
+	InstanceBatch(InstanceBatch&& instanceBatch) noexcept = delete;
+	InstanceBatch& operator=(const InstanceBatch& instanceBatch) noexcept = delete;
+	InstanceBatch& operator=(InstanceBatch&& instanceBatch) noexcept = delete;
+
+public:
+	~InstanceBatch() noexcept = default;
+
+public:
+	void Begin() noexcept;
+	void Submit(class Texture* texture, const Matrix& worldMatrix,
+		const Vector4& uvRect, const Color& color, BlendMode blendMode = BlendMode::Alpha) noexcept;
+	void Submit(class Texture* texture, const InstanceData& instance, BlendMode blendMode = BlendMode::Alpha) noexcept;
+	void End() noexcept;
+	void ResetStats() noexcept;
+
+	static void Pack(InstanceData& instance, const Matrix& worldMatrix,
+		const Vector4& uvRect, const Color& color) noexcept;
+
+public:
+	inline void SetBackend(InstanceBackend* backend) noexcept
+	{
+		_backend = backend;
+	}
+
+	inline uint32 GetMaxInstances() const noexcept
+	{
+		return _maxInstances;
+	}
+
+	inline const BatchStats& GetStats() const noexcept
+	{
+		return _stats;
+	}
+
+private:
+	void Flush() noexcept;
+
+public:
+	constexpr static uint32 DEFAULT_MAX_INSTANCES = 8192;
+
+private:
+	InstanceBackend* _backend;
+
+	std::vector<InstanceData> _instances;
+	std::vector<BatchRange> _ranges;
+
+	uint32 _maxInstances;
+	uint32 _instanceCount;
+	bool _isBegun;
+
+	BatchStats _stats;
+};
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef __MAPPED_FILE_H__
+#define __MAPPED_FILE_H__
+
+#include "Stdafx.h"
+
+class MappedFile
+{
+public:
+	MappedFile() noexcept;
+
+	MappedFile(const MappedFile& mappedFile) noexcept = delete;
+	MappedFile(MappedFile&& mappedFile) noexcept = delete;
+	MappedFile& operator=(const MappedFile& mappedFile) noexcept = delete;
+	MappedFile& operator=(MappedFile&& mappedFile) noexcept = delete;
+
+public:
+	~MappedFile() noexcept;
+
+public:
+	bool Open(const std::filesystem::path& filePath) noexcept;
+	void Close() noexcept;
+
+public:
+	inline bool IsOpen() const noexcept
+	{
+		return _data != nullptr;
+	}
+
+	inline const uint8* GetData() const noexcept
+	{
+		return _data;
+	}
+
+	inline uint64 GetSize() const noexcept
+	{
+		return _size;
+	}
+
+private:
+	const uint8* _data;
+	uint64 _size;
+
+#ifdef _WIN32
+	HANDLE _file;
+	HANDLE _mapping;
+#else
+	int32 _descriptor;
+#endif
+};
+
+#endif
@@ -35,6 +35,7 @@ public:
 	void AddChild(Node* child) noexcept;
 	void RemoveChild(Node* child) noexcept;
 	Node* GetChildByName(const std::string& name) const noexcept;
+	void UpdateBounds() noexcept;
 
 public:
 	inline Node* GetParent() const noexcept
@@ -67,6 +68,16 @@ public:
 		return _name;
 	}
 
+	inline const Bounds& GetBounds() const noexcept
+	{
+		return _bounds;
+	}
+
+	inline const Bounds& GetSubtreeBounds() const noexcept
+	{
+		return _subtreeBounds;
+	}
+
 public:
 	template<typename T>
 	inline T* AddComponent() noexcept
@@ -115,6 +126,8 @@ public:
 	std::vector<std::unique_ptr<Node>> _children;
 	std::vector<std::unique_ptr<Component>> _components;
 	std::string _name;
+	Bounds _bounds;
+	Bounds _subtreeBounds;
 	Transform* _transform;
 	Node* _parent;
 	bool _enabled;
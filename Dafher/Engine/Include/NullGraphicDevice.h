@@ -0,0 +1,40 @@
+#ifndef __NULL_GRAPHIC_DEVICE_H__
+#define __NULL_GRAPHIC_DEVICE_H__
+
+#include "GraphicDevice.h"
+
+class NullGraphicDevice : public GraphicDevice
+{
+public:
+	inline NullGraphicDevice() noexcept
+		: GraphicDevice()
+		, _frameCount(0)
+	{
+	}
+
+	NullGraphicDevice(const NullGraphicDevice& graphicDevice) = delete;
+	NullGraphicDevice(NullGraphicDevice&& graphicDevice) noexcept = delete;
+	NullGraphicDevice& operator=(const NullGraphicDevice& graphicDevice) = delete;
+	NullGraphicDevice& operator=(NullGraphicDevice&& graphicDevice) = delete;
+
+public:
+	virtual ~NullGraphicDevice() noexcept override = default;
+
+public:
+	virtual bool Init(class Window* window) noexcept override;
+	virtual void BeginFrame() noexcept override;
+	virtual void EndFrame() noexcept override;
+	virtual void Clear() noexcept override;
+	virtual class GraphicContext* GetContext() const noexcept override;
+
+public:
+	inline uint64 GetFrameCount() const noexcept
+	{
+		return _frameCount;
+	}
+
+private:
+	uint64 _frameCount;
+};
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef __NULL_RENDER_SUBMITTER_H__
+#define __NULL_RENDER_SUBMITTER_H__
+
+#include "RenderSnapshot.h"
+
+class NullRenderSubmitter : public RenderSubmitter
+{
+public:
+	NullRenderSubmitter() noexcept
+		: _frameCount(0)
+		, _viewCount(0)
+		, _itemCount(0)
+		, _lastFrameIndex(0)
+	{
+	}
+
+	NullRenderSubmitter(const NullRenderSubmitter& submitter) noexcept = delete;
+	NullRenderSubmitter(NullRenderSubmitter&& submitter) noexcept = delete;
+	NullRenderSubmitter& operator=(const NullRenderSubmitter& submitter) noexcept = delete;
+	NullRenderSubmitter& operator=(NullRenderSubmitter&& submitter) noexcept = delete;
+
+public:
+	virtual ~NullRenderSubmitter() noexcept override = default;
+
+public:
+	virtual void Render(const RenderSnapshot& snapshot) noexcept override;
+
+	void Reset() noexcept;
+
+public:
+	inline uint64 GetFrameCount() const noexcept
+	{
+		return _frameCount;
+	}
+
+	inline uint64 GetViewCount() const noexcept
+	{
+		return _viewCount;
+	}
+
+	inline uint64 GetItemCount() const noexcept
+	{
+		return _itemCount;
+	}
+
+	inline uint64 GetLastFrameIndex() const noexcept
+	{
+		return _lastFrameIndex;
+	}
+
+private:
+	uint64 _frameCount;
+	uint64 _viewCount;
+	uint64 _itemCount;
+	uint64 _lastFrameIndex;
+};
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef __PLATFORM_H__
+#define __PLATFORM_H__
+
+#include "Stdafx.h"
+
+class Platform
+{
+public:
+	Platform() noexcept = delete;
+
+public:
+	static void DebugOutput(const std::string& message) noexcept;
+	static void EnumerateFiles(const std::filesystem::path& folderPath,
+		std::vector<std::filesystem::path>& files) noexcept;
+	static std::string ToUtf8(const std::filesystem::path& path) noexcept;
+	static bool EvictFileCache(const std::filesystem::path& filePath) noexcept;
+};
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef __QUAD_BATCH_H__
+#define __QUAD_BATCH_H__
+
+#include "Stdafx.h"
+
+enum class BlendMode : uint8
+{
+	Alpha,
+	Additive,
+	Count
+};
+
+struct BatchRange
+{
+	class Texture* _texture;
+	uint32 _firstQuad;
+	uint32 _quadCount;
+	BlendMode _blendMode;
+};
+
+struct BatchStats
+{
+	uint32 _quadCount;
+	uint32 _rangeCount;
+	uint32 _flushCount;
+};
+
+class BatchBackend
+{
+public:
+	virtual ~BatchBackend() noexcept = default;
+
+public:
+	virtual void Flush(const BatchVertex* vertices, uint32 quadCount,
+		const BatchRange* ranges, uint32 rangeCount) noexcept = 0;
+};
+
+class QuadBatch
+{
+public:
+	QuadBatch(uint32 maxQuads = DEFAULT_MAX_QUADS) noexcept;
+
+	QuadBatch(const QuadBatch& quadBatch) noexcept = delete;
+	QuadBatch(QuadBatch&& quadBatch) noexcept = delete;
+	QuadBatch& operator=(const QuadBatch& quadBatch) noexcept = delete;
+	QuadBatch& operator=(QuadBatch&& quadBatch) noexcept = delete;
+
+public:
+	~QuadBatch() noexcept = default;
+
+public:
+	void Begin() noexcept;
+	void Submit(class Texture* texture, const Matrix& worldMatrix,
+		const Vector4& uvRect, const Color& color, BlendMode blendMode = BlendMode::Alpha) noexcept;
+	void Submit(class Texture* texture, const InstanceData& instance, BlendMode blendMode = BlendMode::Alpha) noexcept;
+	void End() noexcept;
+	void ResetStats() noexcept;
+
+public:
+	inline void SetBackend(BatchBackend* backend) noexcept
+	{
+		_backend = backend;
+	}
+
+	inline uint32 GetMaxQuads() const noexcept
+	{
+		return _maxQuads;
+	}
+
+	inline const BatchStats& GetStats() const noexcept
+	{
+		return _stats;
+	}
+
+private:
+	void Flush() noexcept;
+
+public:
+	constexpr static uint32 DEFAULT_MAX_QUADS = 4096;
+
+private:
+	BatchBackend* _backend;
+
+	std::vector<BatchVertex> _vertices;
+	std::vector<BatchRange> _ranges;
+
+	uint32 _maxQuads;
+	uint32 _quadCount;
+	bool _isBegun;
+
+	BatchStats _stats;
+};
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef __RECORDING_BATCH_BACKEND_H__
+#define __RECORDING_BATCH_BACKEND_H__
+
+#include "QuadBatch.h"
+#include "InstanceBatch.h"
+
+struct RecordedDraw
+{
+	class Texture* _texture;
+	uint32 _flushIndex;
+	uint32 _first;
+	uint32 _count;
+	BlendMode _blendMode;
+};
+
+class RecordingBatchBackend : public BatchBackend, public InstanceBackend
+{
+public:
+	RecordingBatchBackend() noexcept
+		: _flushCount(0)
+	{
+	}
+
+	RecordingBatchBackend(const RecordingBatchBackend& backend) noexcept = delete;
+	RecordingBatchBackend(RecordingBatchBackend&& backend) noexcept = delete;
+	RecordingBatchBackend& operator=(const RecordingBatchBackend& backend) noexcept = delete;
+	RecordingBatchBackend& operator=(RecordingBatchBackend&& backend) noexcept = delete;
+
+public:
+	virtual ~RecordingBatchBackend() noexcept override = default;
+
+public:
+	virtual void Flush(const BatchVertex* vertices, uint32 quadCount,
+		const BatchRange* ranges, uint32 rangeCount) noexcept override;
+	virtual void Flush(const InstanceData* instances, uint32 instanceCount,
+		const BatchRange* ranges, uint32 rangeCount) noexcept override;
+
+	void Reset() noexcept;
+
+public:
+	inline uint32 GetFlushCount() const noexcept
+	{
+		return _flushCount;
+	}
+
+	inline uint32 GetDrawCount() const noexcept
+	{
+		return static_cast<uint32>(_draws.size());
+	}
+
+	inline const std::vector<RecordedDraw>& GetDraws() const noexcept
+	{
+		return _draws;
+	}
+
+	inline const std::vector<BatchVertex>& GetVertices() const noexcept
+	{
+		return _vertices;
+	}
+
+	inline const std::vector<InstanceData>& GetInstances() const noexcept
+	{
+		return _instances;
+	}
+
+private:
+	std::vector<RecordedDraw> _draws;
+	std::vector<BatchVertex> _vertices;
+	std::vector<InstanceData> _instances;
+	uint32 _flushCount;
+};
+
+#endif
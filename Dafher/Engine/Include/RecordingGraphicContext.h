@@ -0,0 +1,112 @@
+#ifndef __RECORDING_GRAPHIC_CONTEXT_H__
+#define __RECORDING_GRAPHIC_CONTEXT_H__
+
+#include "GraphicContext.h"
+#include "RenderStateCache.h"
+
+class RecordingGraphicContext : public GraphicContext
+{
+public:
+	inline RecordingGraphicContext() noexcept
+		: _hasResources(false)
+	{
+		Reset();
+	}
+
+	RecordingGraphicContext(const RecordingGraphicContext& graphicContext) noexcept = delete;
+	RecordingGraphicContext(RecordingGraphicContext&& graphicContext) noexcept = delete;
+	RecordingGraphicContext& operator=(const RecordingGraphicContext& graphicContext) noexcept = delete;
+	RecordingGraphicContext& operator=(RecordingGraphicContext&& graphicContext) noexcept = delete;
+
+public:
+	virtual ~RecordingGraphicContext() noexcept override = default;
+
+public:
+	virtual bool CreateResources(uint32 maxQuads, uint32 maxInstances) noexcept override;
+	virtual std::unique_ptr<GraphicTexture> CreateTexture(const class Texture& texture) noexcept override;
+	virtual void SetViewport(const Vector4& viewport) noexcept override;
+	virtual void UpdateBuffer(GraphicBuffer buffer, const void* data, size_t dataSize) noexcept override;
+	virtual void UpdateTexture(class Texture* texture,
+		uint32 x, uint32 y, uint32 width, uint32 height, const uint8* data) noexcept override;
+
+	virtual void SetRasterizerState() noexcept override;
+	virtual void SetBlendState(BlendMode blendMode) noexcept override;
+	virtual void SetVertexShader(GraphicShader shader) noexcept override;
+	virtual void SetPixelShader(GraphicShader shader) noexcept override;
+	virtual void SetInputLayout(GraphicInputLayout inputLayout) noexcept override;
+	virtual void SetConstantBuffer(GraphicBuffer buffer) noexcept override;
+	virtual void SetSampler() noexcept override;
+	virtual void SetTopology() noexcept override;
+	virtual void SetVertexBuffer(uint32 slot, GraphicBuffer buffer, uint32 stride) noexcept override;
+	virtual void SetIndexBuffer(GraphicBuffer buffer) noexcept override;
+	virtual void SetTexture(const class Texture* texture) noexcept override;
+
+	virtual void DrawIndexed(uint32 indexCount, uint32 firstIndex) noexcept override;
+	virtual void DrawIndexedInstanced(uint32 indexCount, uint32 instanceCount, uint32 firstInstance) noexcept override;
+
+	virtual uint64 GetTextureBinding(const class Texture* texture) const noexcept override;
+
+	void Reset() noexcept;
+
+public:
+	inline uint32 GetBindCount(RenderBinding binding) const noexcept
+	{
+		return _bindCounts[static_cast<size_t>(binding)];
+	}
+
+	inline uint32 GetBufferUpdateCount(GraphicBuffer buffer) const noexcept
+	{
+		return _bufferUpdateCounts[static_cast<size_t>(buffer)];
+	}
+
+	inline uint32 GetTextureCount() const noexcept
+	{
+		return _textureCount;
+	}
+
+	inline uint32 GetTextureUpdateCount() const noexcept
+	{
+		return _textureUpdateCount;
+	}
+
+	inline uint32 GetViewportCount() const noexcept
+	{
+		return _viewportCount;
+	}
+
+	inline uint32 GetDrawCount() const noexcept
+	{
+		return _drawCount;
+	}
+
+	inline uint64 GetIndexCount() const noexcept
+	{
+		return _indexCount;
+	}
+
+	inline uint64 GetInstanceCount() const noexcept
+	{
+		return _instanceCount;
+	}
+
+	inline bool HasResources() const noexcept
+	{
+		return _hasResources;
+	}
+
+private:
+	void Record(RenderBinding binding) noexcept;
+
+private:
+	std::array<uint32, static_cast<size_t>(RenderBinding::Count)> _bindCounts;
+	std::array<uint32, static_cast<size_t>(GraphicBuffer::Count)> _bufferUpdateCounts;
+	uint32 _textureCount;
+	uint32 _textureUpdateCount;
+	uint32 _viewportCount;
+	uint32 _drawCount;
+	uint64 _indexCount;
+	uint64 _instanceCount;
+	bool _hasResources;
+};
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef __RENDER_QUEUE_H__
+#define __RENDER_QUEUE_H__
+
+#include "QuadBatch.h"
+
+struct RenderQueueEntry
+{
+	uint64 _key;
+	uint32 _index;
+};
+
+class RenderQueue
+{
+public:
+	inline RenderQueue() noexcept
+		: _lastSortTime(0.0f)
+	{
+	}
+
+	RenderQueue(const RenderQueue& renderQueue) noexcept = delete;
+	RenderQueue(RenderQueue&& renderQueue) noexcept = delete;
+	RenderQueue& operator=(const RenderQueue& renderQueue) noexcept = delete;
+	RenderQueue& operator=(RenderQueue&& renderQueue) noexcept = delete;
+
+public:
+	~RenderQueue() noexcept = default;
+
+public:
+	void Clear() noexcept;
+	void Push(uint64 key, uint32 index) noexcept;
+	void Sort() noexcept;
+
+	static uint64 MakeKey(uint8 layer, BlendMode blendMode, uint32 textureId, float depth) noexcept;
+
+public:
+	inline const std::vector<RenderQueueEntry>& GetEntries() const noexcept
+	{
+		return _entries;
+	}
+
+	inline uint32 GetCount() const noexcept
+	{
+		return static_cast<uint32>(_entries.size());
+	}
+
+	inline float GetLastSortTime() const noexcept
+	{
+		return _lastSortTime;
+	}
+
+public:
+	constexpr static uint32 LAYER_SHIFT = 56;
+	constexpr static uint32 BLEND_MODE_SHIFT = 52;
+	constexpr static uint32 TEXTURE_ID_SHIFT = 32;
+	constexpr static uint32 MAX_TEXTURE_ID = (1u << 20) - 1;
+
+private:
+	constexpr static uint32 RADIX_BITS = 8;
+	constexpr static uint32 RADIX_SIZE = 1u << RADIX_BITS;
+	constexpr static uint32 PASS_COUNT = 64 / RADIX_BITS;
+
+private:
+	std::vector<RenderQueueEntry> _entries;
+	std::vector<RenderQueueEntry> _scratch;
+	float _lastSortTime;
+};
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef __RENDER_SNAPSHOT_H__
+#define __RENDER_SNAPSHOT_H__
+
+#include "Stdafx.h"
+#include "QuadBatch.h"
+#include "Bounds.h"
+
+struct DrawItem
+{
+	class Texture* _texture;
+	InstanceData _instance;
+	Bounds _bounds;
+	uint8 _layer;
+	BlendMode _blendMode;
+};
+
+struct SnapshotView
+{
+	Matrix _viewProjection;
+	Vector4 _viewport;
+	uint32 _firstItem;
+	uint32 _itemCount;
+};
+
+struct TextureUpload
+{
+	class Texture* _texture;
+	uint32 _x;
+	uint32 _y;
+	uint32 _width;
+	uint32 _height;
+	size_t _dataOffset;
+};
+
+struct RenderSnapshot
+{
+	inline void Clear() noexcept
+	{
+		_drawItems.clear();
+		_visibleItems.clear();
+		_views.clear();
+		_uploads.clear();
+		_uploadData.clear();
+	}
+
+	std::vector<DrawItem> _drawItems;
+	std::vector<uint32> _visibleItems;
+	std::vector<SnapshotView> _views;
+	std::vector<TextureUpload> _uploads;
+	std::vector<uint8> _uploadData;
+	uint64 _frameIndex;
+};
+
+class RenderSubmitter
+{
+public:
+	virtual ~RenderSubmitter() noexcept = default;
+
+public:
+	virtual void Render(const RenderSnapshot& snapshot) noexcept = 0;
+};
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef __RENDER_STATE_CACHE_H__
+#define __RENDER_STATE_CACHE_H__
+
+#include "Stdafx.h"
+
+enum class RenderBinding : uint32
+{
+	RasterizerState,
+	BlendState,
+	VertexShader,
+	PixelShader,
+	InputLayout,
+	ConstantBuffer,
+	Sampler,
+	ShaderResource,
+	VertexBuffer0,
+	VertexBuffer1,
+	IndexBuffer,
+	Topology,
+	Count
+};
+
+class RenderStateCache
+{
+public:
+	inline RenderStateCache() noexcept
+	{
+		Invalidate();
+		ResetCounters();
+	}
+
+	RenderStateCache(const RenderStateCache& renderStateCache) noexcept = delete;
+	RenderStateCache(RenderStateCache&& renderStateCache) noexcept = delete;
+	RenderStateCache& operator=(const RenderStateCache& renderStateCache) noexcept = delete;
+	RenderStateCache& operator=(RenderStateCache&& renderStateCache) noexcept = delete;
+
+public:
+	~RenderStateCache() noexcept = default;
+
+public:
+	bool Bind(RenderBinding binding, uint64 value) noexcept;
+	void Invalidate() noexcept;
+	void ResetCounters() noexcept;
+
+	uint32 GetIssuedCount() const noexcept;
+	uint32 GetElidedCount() const noexcept;
+
+public:
+	template<typename T>
+	inline bool Bind(RenderBinding binding, const T* value) noexcept
+	{
+		return Bind(binding, static_cast<uint64>(reinterpret_cast<uintptr_t>(value)));
+	}
+
+	inline uint32 GetIssuedCount(RenderBinding binding) const noexcept
+	{
+		return _issuedCounts[static_cast<size_t>(binding)];
+	}
+
+	inline uint32 GetElidedCount(RenderBinding binding) const noexcept
+	{
+		return _elidedCounts[static_cast<size_t>(binding)];
+	}
+
+private:
+	constexpr static size_t BINDING_COUNT = static_cast<size_t>(RenderBinding::Count);
+	constexpr static uint64 UNBOUND = ~0ull;
+
+private:
+	std::array<uint64, BINDING_COUNT> _boundValues;
+	std::array<uint32, BINDING_COUNT> _issuedCounts;
+	std::array<uint32, BINDING_COUNT> _elidedCounts;
+};
+
+#endif
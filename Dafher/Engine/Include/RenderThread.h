@@ -0,0 +1,85 @@
+#ifndef __RENDER_THREAD_H__
+#define __RENDER_THREAD_H__
+
+#include "RenderSnapshot.h"
+
+class RenderThread
+{
+public:
+	RenderThread() noexcept;
+
+	RenderThread(const RenderThread& renderThread) noexcept = delete;
+	RenderThread(RenderThread&& renderThread) noexcept = delete;
+	RenderThread& operator=(const RenderThread& renderThread) noexcept = delete;
+	RenderThread& operator=(RenderThread&& renderThread) noexcept = delete;
+
+public:
+	~RenderThread() noexcept;
+
+public:
+	void Start() noexcept;
+	void Stop() noexcept;
+	void Publish() noexcept;
+	void WaitIdle() noexcept;
+
+public:
+	inline void SetSubmitter(RenderSubmitter* submitter) noexcept
+	{
+		assert(!_isRunning);
+
+		_submitter = submitter;
+	}
+
+	inline RenderSubmitter* GetSubmitter() const noexcept
+	{
+		return _submitter;
+	}
+
+	inline RenderSnapshot& GetWriteSnapshot() noexcept
+	{
+		return _snapshots[_writeIndex];
+	}
+
+	inline bool IsRunning() const noexcept
+	{
+		return _isRunning;
+	}
+
+	inline uint64 GetPublishedFrameCount() const noexcept
+	{
+		return _publishedFrameCount;
+	}
+
+	inline uint64 GetRenderedFrameCount() const noexcept
+	{
+		return _renderedFrameCount;
+	}
+
+	inline float GetLastWaitTime() const noexcept
+	{
+		return _lastWaitTime;
+	}
+
+private:
+	void Run() noexcept;
+
+private:
+	std::array<RenderSnapshot, 2> _snapshots;
+	std::thread _thread;
+	std::mutex _mutex;
+	std::condition_variable _condition;
+	RenderSubmitter* _submitter;
+
+	uint32 _writeIndex;
+	uint32 _pendingIndex;
+	uint64 _publishedFrameCount;
+	std::atomic<uint64> _renderedFrameCount;
+	float _lastWaitTime;
+
+	bool _hasPending;
+	bool _isRendering;
+	bool _isRunning;
+	bool _isStopping;
+};
+
+#endif
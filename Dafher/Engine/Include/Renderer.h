@@ -2,11 +2,42 @@
 #define __RENDERER_H__
 
 #include "Stdafx.h"
+#include "QuadBatch.h"
+#include "InstanceBatch.h"
+#include "RenderStateCache.h"
+#include "RenderQueue.h"
+#include "RenderSnapshot.h"
+#include "GraphicContext.h"
 
-class Renderer
+enum class RenderMode
+{
+	Batched,
+	Instanced
+};
+
+struct CullingStats
+{
+	uint32 _visibleCount;
+	uint32 _culledCount;
+	uint32 _culledSubtreeCount;
+};
+
+class Renderer : public BatchBackend, public InstanceBackend, public RenderSubmitter
 {	
 public:
-	Renderer() noexcept = default;
+	inline Renderer() noexcept
+		: _context(nullptr)
+		, _snapshot(nullptr)
+		, _defaultViewMatrix(DirectX::XMMatrixIdentity())
+		, _defaultProjectionMatrix(DirectX::XMMatrixIdentity())
+		, _screenSize(Vector2::Zero)
+		, _cullingStats{}
+		, _frameIndex(0)
+		, _renderMode(RenderMode::Batched)
+		, _isCullingEnabled(true)
+		, _isSubtreeCullingEnabled(false)
+	{
+	}
 
 	Renderer(const Renderer& renderer) noexcept = delete;
 	Renderer(Renderer&& renderer) noexcept = delete;
@@ -14,32 +45,137 @@ public:
 	Renderer& operator=(Renderer&& renderer) noexcept = delete;
 
 public:
-	~Renderer() noexcept = default;
+	virtual ~Renderer() noexcept override = default;
+
+public:
+	bool Init(GraphicContext* context) noexcept;
+
+	void Begin(RenderSnapshot& snapshot) noexcept;
+	void Submit(class Texture* texture, const Matrix& worldMatrix, const Color& color = Color(1.0f, 1.0f, 1.0f, 1.0f)) noexcept;
+	void Submit(class Texture* texture, const Matrix& worldMatrix, const Vector4& uvRect, const Color& color,
+		uint8 layer = 0, BlendMode blendMode = BlendMode::Alpha) noexcept;
+	void SubmitUpload(class Texture* texture, uint32 x, uint32 y, uint32 width, uint32 height, const uint8* data) noexcept;
+	void End() noexcept;
+	void InvalidateState() noexcept;
+
+	void SetScreenSize(uint32 width, uint32 height) noexcept;
+	void AddCamera(class Camera* camera) noexcept;
+	void RemoveCamera(class Camera* camera) noexcept;
+	bool IsVisible(const Bounds& bounds) const noexcept;
+
+	virtual void Render(const RenderSnapshot& snapshot) noexcept override;
+	virtual void Flush(const BatchVertex* vertices, uint32 quadCount,
+		const BatchRange* ranges, uint32 rangeCount) noexcept override;
+	virtual void Flush(const InstanceData* instances, uint32 instanceCount,
+		const BatchRange* ranges, uint32 rangeCount) noexcept override;
 
 public:
-	bool Init(const ComPtr<ID3D11Device>& device, const ComPtr<ID3D11DeviceContext>& deviceContext) noexcept;
-	void Draw(class Texture* texture, const Matrix& worldMatrix) noexcept;
+	inline void SetRenderMode(RenderMode renderMode) noexcept
+	{
+		_renderMode = renderMode;
+	}
+
+	inline RenderMode GetRenderMode() const noexcept
+	{
+		return _renderMode;
+	}
+
+	inline void SetCullingEnabled(bool isCullingEnabled) noexcept
+	{
+		_isCullingEnabled = isCullingEnabled;
+	}
+
+	inline bool IsCullingEnabled() const noexcept
+	{
+		return _isCullingEnabled;
+	}
+
+	inline void SetSubtreeCullingEnabled(bool isSubtreeCullingEnabled) noexcept
+	{
+		_isSubtreeCullingEnabled = isSubtreeCullingEnabled;
+	}
+
+	inline bool IsSubtreeCullingEnabled() const noexcept
+	{
+		return _isSubtreeCullingEnabled;
+	}
+
+	inline void AddCulledSubtree() noexcept
+	{
+		++_cullingStats._culledSubtreeCount;
+	}
+
+	inline const CullingStats& GetCullingStats() const noexcept
+	{
+		return _cullingStats;
+	}
+
+	inline uint64 GetFrameIndex() const noexcept
+	{
+		return _frameIndex;
+	}
+
+	inline const BatchStats& GetBatchStats() const noexcept
+	{
+		return _renderMode == RenderMode::Instanced ? _instanceBatch.GetStats() : _quadBatch.GetStats();
+	}
+
+	inline const RenderStateCache& GetStateCache() const noexcept
+	{
+		return _stateCache;
+	}
+
+	inline const RenderQueue& GetRenderQueue() const noexcept
+	{
+		return _renderQueue;
+	}
+
+	inline const Vector2& GetScreenSize() const noexcept
+	{
+		return _screenSize;
+	}
+
+	inline const std::vector<class Camera*>& GetCameras() const noexcept
+	{
+		return _cameras;
+	}
+
+	inline const Bounds& GetDefaultViewBounds() const noexcept
+	{
+		return _defaultViewBounds;
+	}
 
 private:
-	bool CreateShaders() noexcept;
-	bool CreateBuffers() noexcept;
-	bool CreateStates() noexcept;
+	void BindPipeline(GraphicShader vertexShader, GraphicShader pixelShader,
+		GraphicInputLayout inputLayout, GraphicBuffer constantBuffer) noexcept;
+	void BindBlendState(BlendMode blendMode) noexcept;
+	void BindVertexBuffer(uint32 slot, GraphicBuffer vertexBuffer, uint32 stride) noexcept;
+	void BindIndexBuffer(GraphicBuffer indexBuffer) noexcept;
+	void BindTexture(class Texture* texture) noexcept;
+
+	void AddView(const Matrix& viewProjectionMatrix, const Vector4& viewport, const Bounds& viewBounds) noexcept;
+	void RenderView(const RenderSnapshot& snapshot, const SnapshotView& view) noexcept;
 
 private:
-	ComPtr<ID3D11Device> _device;
-	ComPtr<ID3D11DeviceContext> _deviceContext;
+	GraphicContext* _context;
 
-	ComPtr<ID3D11VertexShader> _vertexShader;
-	ComPtr<ID3D11PixelShader> _pixelShader;
-	ComPtr<ID3D11InputLayout> _inputLayout;
+	RenderSnapshot* _snapshot;
+	RenderQueue _renderQueue;
+	std::vector<class Camera*> _cameras;
 
-	ComPtr<ID3D11Buffer> _quadVertexBuffer;
-	ComPtr<ID3D11Buffer> _quadIndexBuffer;
-	ComPtr<ID3D11Buffer> _quadConstantBuffer;
+	Matrix _defaultViewMatrix;
+	Matrix _defaultProjectionMatrix;
+	Vector2 _screenSize;
+	Bounds _defaultViewBounds;
+	CullingStats _cullingStats;
+	uint64 _frameIndex;
 
-	ComPtr<ID3D11RasterizerState> _rasterizerState;
-	ComPtr<ID3D11SamplerState> _samplerState;
-	ComPtr<ID3D11BlendState> _blendState;
+	QuadBatch _quadBatch;
+	InstanceBatch _instanceBatch;
+	RenderStateCache _stateCache;
+	RenderMode _renderMode;
+	bool _isCullingEnabled;
+	bool _isSubtreeCullingEnabled;
 };
 
 #endif
\ No newline at end of file
@@ -21,6 +21,21 @@ public:
 
 public:
 	virtual bool Init() override;
+
+public:
+	inline const std::vector<std::string>& GetPreloadTextures() const noexcept
+	{
+		return _preloadTextures;
+	}
+
+protected:
+	inline void AddPreloadTexture(const std::string& textureKey) noexcept
+	{
+		_preloadTextures.push_back(textureKey);
+	}
+
+private:
+	std::vector<std::string> _preloadTextures;
 };
 
 #endif
\ No newline at end of file
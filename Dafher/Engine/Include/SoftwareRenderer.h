@@ -0,0 +1,105 @@
+#ifndef __SOFTWARE_RENDERER_H__
+#define __SOFTWARE_RENDERER_H__
+
+#include "RenderSnapshot.h"
+
+struct SoftwareRenderStats
+{
+	uint32 _spriteCount;
+	uint32 _binnedCount;
+	uint64 _pixelCount;
+	uint32 _threadCount;
+	float _renderTime;
+	float _spritesPerSecond;
+	float _megapixelsPerSecond;
+};
+
+class SoftwareRenderer : public RenderSubmitter
+{
+public:
+	SoftwareRenderer(uint32 width, uint32 height, uint32 threadCount = 0) noexcept;
+
+	SoftwareRenderer(const SoftwareRenderer& renderer) noexcept = delete;
+	SoftwareRenderer(SoftwareRenderer&& renderer) noexcept = delete;
+	SoftwareRenderer& operator=(const SoftwareRenderer& renderer) noexcept = delete;
+	SoftwareRenderer& operator=(SoftwareRenderer&& renderer) noexcept = delete;
+
+public:
+	virtual ~SoftwareRenderer() noexcept override = default;
+
+public:
+	virtual void Render(const RenderSnapshot& snapshot) noexcept override;
+
+	void Resize(uint32 width, uint32 height) noexcept;
+	void Clear() noexcept;
+	bool SaveImage(const std::filesystem::path& filePath) const noexcept;
+
+public:
+	inline void SetClearColor(const Color& clearColor) noexcept
+	{
+		_clearColor = clearColor;
+	}
+
+	inline uint32 GetWidth() const noexcept
+	{
+		return _width;
+	}
+
+	inline uint32 GetHeight() const noexcept
+	{
+		return _height;
+	}
+
+	inline const std::vector<uint8>& GetPixels() const noexcept
+	{
+		return _pixels;
+	}
+
+	inline const SoftwareRenderStats& GetStats() const noexcept
+	{
+		return _stats;
+	}
+
+public:
+	constexpr static uint32 TILE_SIZE = 64;
+
+private:
+	struct RasterQuad
+	{
+		const class Texture* _texture;
+		float _originX;
+		float _originY;
+		float _inverse[4];
+		Vector4 _uvRect;
+		Color _color;
+		int32 _minX;
+		int32 _minY;
+		int32 _maxX;
+		int32 _maxY;
+		BlendMode _blendMode;
+	};
+
+private:
+	void BinView(const RenderSnapshot& snapshot, const SnapshotView& view) noexcept;
+	void RasterizeTiles() noexcept;
+	uint64 RasterizeTile(uint32 tileIndex) noexcept;
+	uint64 RasterizeQuad(const RasterQuad& quad, int32 minX, int32 minY, int32 maxX, int32 maxY) noexcept;
+
+private:
+	std::vector<uint8> _pixels;
+	std::vector<RasterQuad> _quads;
+	std::vector<std::vector<uint32>> _tileBins;
+	std::atomic<uint32> _nextTile;
+	std::atomic<uint64> _pixelCount;
+
+	Color _clearColor;
+	SoftwareRenderStats _stats;
+
+	uint32 _width;
+	uint32 _height;
+	uint32 _tilesX;
+	uint32 _tilesY;
+	uint32 _threadCount;
+};
+
+#endif
@@ -3,13 +3,22 @@
 
 #include "Component.h"
 #include "Texture.h"
+#include "QuadBatch.h"
+#include "TextureStreamer.h"
+#include "TextureHandle.h"
+#include "Flipbook.h"
 
 class Sprite : public Component
 {
 protected:
 	inline Sprite() noexcept
 		: Component()
-		, _texture(nullptr)
+		, _handle()
+		, _region(nullptr)
+		, _variant(nullptr)
+		, _variantSource(nullptr)
+		, _flipbook(nullptr)
+		, _flipbookFrameDuration(0.0f)
 		, _isPlaying(false)
 		, _loop(true)
 		, _isDirty(false)
@@ -18,12 +27,18 @@ protected:
 		, _color(Vector4::One)
 		, _size(Vector2::Zero)
 		, _anchorPoint(Vector2(0.5f, 0.5f))
+		, _layer(0)
+		, _blendMode(BlendMode::Alpha)
+		, _cachedWorldVersion(0)
+		, _isWorldDirty(true)
 		, _onAnimationComplete(nullptr)
 	{
 	}
 
-	Sprite(const std::string& textureKey) noexcept;
-	Sprite(const std::string& textureKey, uint32 width, uint32 height) noexcept;
+	Sprite(const TextureKey& textureKey) noexcept;
+	Sprite(const TextureKey& textureKey, uint32 width, uint32 height) noexcept;
+	Sprite(const TextureKey& textureKey, StreamPriority priority) noexcept;
+	Sprite(const Flipbook* flipbook, float frameDuration = 0.1f) noexcept;
 
 	Sprite(const Sprite& sprite) noexcept = delete;
 	Sprite(Sprite&& sprite) noexcept = delete;
@@ -31,7 +46,7 @@ protected:
 	Sprite& operator=(Sprite&& sprite) noexcept = delete;
 
 public:
-	virtual ~Sprite() noexcept override = default;
+	virtual ~Sprite() noexcept override;
 
 public:
 	CREATE(Sprite)
@@ -48,6 +63,7 @@ public:
 		_size.x = static_cast<float>(width);
 		_size.y = static_cast<float>(height);
 		_isDirty = true;
+		_isWorldDirty = true;
 	}
 
 	inline void SetWidth(uint32 width) noexcept
@@ -59,6 +75,7 @@ public:
 
 		_size.x = static_cast<float>(width);
 		_isDirty = true;
+		_isWorldDirty = true;
 	}
 
 	inline void SetHeight(uint32 height) noexcept
@@ -70,6 +87,7 @@ public:
 
 		_size.y = static_cast<float>(height);
 		_isDirty = true;
+		_isWorldDirty = true;
 	}
 
 	inline uint32 GetWidth() const noexcept
@@ -91,11 +109,13 @@ public:
 	{
 		_anchorPoint.x = x;
 		_anchorPoint.y = y;
+		_isWorldDirty = true;
 	}
 
 	inline void SetAnchorPoint(const Vector2& anchor) noexcept
 	{
 		_anchorPoint = anchor;
+		_isWorldDirty = true;
 	}
 
 	inline const Vector2& GetAnchorPoint() const noexcept
@@ -103,17 +123,47 @@ public:
 		return _anchorPoint;
 	}
 
+	inline void SetColor(const Color& color) noexcept
+	{
+		_color = color;
+	}
+
+	inline const Color& GetColor() const noexcept
+	{
+		return _color;
+	}
+
+	inline void SetLayer(uint8 layer) noexcept
+	{
+		_layer = layer;
+	}
+
+	inline uint8 GetLayer() const noexcept
+	{
+		return _layer;
+	}
+
+	inline void SetBlendMode(BlendMode blendMode) noexcept
+	{
+		_blendMode = blendMode;
+	}
+
+	inline BlendMode GetBlendMode() const noexcept
+	{
+		return _blendMode;
+	}
+
 	inline void Play(bool loop = true) noexcept
 	{
 		_loop = loop;
 		_isPlaying = true;
 
-		if (_textures.empty())
+		if (_frames.empty())
 		{
 			return;
 		}
 		
-		_texture = _textures[0];
+		_handle = _frames[0];
 	}
 
 	inline void Stop() noexcept
@@ -145,7 +195,12 @@ public:
 
 	inline size_t GetFrameCount() const
 	{
-		return _textures.size();
+		return _flipbook != nullptr ? _flipbook->_frames.size() : _frames.size();
+	}
+
+	inline const Flipbook* GetFlipbook() const noexcept
+	{
+		return _flipbook;
 	}
 
 	inline void SetOnAnimationComplete(std::function<void()> callback) noexcept
@@ -158,15 +213,26 @@ public:
 	virtual void PreUpdate(float delta) override;
 	virtual void Update(float delta) override;
 	virtual void PostUpdate(float delta) override;
+	virtual bool GetWorldBounds(Bounds& bounds) const override;
 
-	void AddFrame(const std::string& textureKey, float duration = 0.1f);
+	void AddFrame(const TextureKey& textureKey, float duration = 0.1f);
+	void SetFlipbook(const Flipbook* flipbook, float frameDuration = 0.1f) noexcept;
 	void UpdateAnimation(float delta) noexcept;
 
 private:
-	class Texture* _texture;
+	void RefreshWorld() const noexcept;
+	void RefreshVariant() noexcept;
+
+private:
+	TextureHandle _handle;
+	const TextureRegion* _region;
+	Texture* _variant;
+	const Texture* _variantSource;
 
-	std::vector<class Texture*> _textures;
+	std::vector<TextureHandle> _frames;
 	std::vector<float> _frameDurations;
+	const Flipbook* _flipbook;
+	float _flipbookFrameDuration;
 
 	bool _isPlaying;
 	bool _loop;
@@ -178,6 +244,14 @@ private:
 	Vector2 _size;
 	Vector2 _anchorPoint;
 
+	uint8 _layer;
+	BlendMode _blendMode;
+
+	mutable Matrix _worldMatrix;
+	mutable Bounds _worldBounds;
+	mutable uint32 _cachedWorldVersion;
+	mutable bool _isWorldDirty;
+
 	std::function<void()> _onAnimationComplete;
 };
 
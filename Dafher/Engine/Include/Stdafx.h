@@ -1,42 +1,70 @@
 ﻿#ifndef __STDAFX_H__
 #define __STDAFX_H__
 
+#ifdef _WIN32
 #include <Windows.h>
 #include <tchar.h>
+#endif
+
 #include <assert.h>
 #include <algorithm>
+#include <array>
 #include <cctype>
 #include <cwctype>
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <unordered_set>
+#include <deque>
+#include <functional>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
 #include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
 #include <memory_resource>
 #include <fstream>
 
+#ifdef _WIN32
 #include <d3d11.h>
 #include <d3dcompiler.h>
-#include <DirectXMath.h>
 #include <wrl/client.h>
+#else
+#include <wsl/winadapter.h>
+
+#ifndef __cdecl
+#define __cdecl
+#endif
+#endif
+
+#include <DirectXMath.h>
 #include <SimpleMath.h>
 
+#ifdef _WIN32
 #pragma comment(lib, "Engine.lib")
 #pragma comment(lib, "d3d11.lib")
 #pragma comment(lib, "dxgi.lib")
 #pragma comment(lib, "d3dcompiler.lib")
+#endif
 
-using int8 = __int8;
-using int16 = __int16;
-using int32 = __int32;
-using int64 = __int64;
-using uint8 = unsigned __int8;
-using uint16 = unsigned __int16;
-using uint32 = unsigned __int32;
-using uint64 = unsigned __int64;
+using int8 = std::int8_t;
+using int16 = std::int16_t;
+using int32 = std::int32_t;
+using int64 = std::int64_t;
+using uint8 = std::uint8_t;
+using uint16 = std::uint16_t;
+using uint32 = std::uint32_t;
+using uint64 = std::uint64_t;
 
+#ifdef _WIN32
 using namespace Microsoft::WRL;
+#endif
 
 using Vector2 = DirectX::SimpleMath::Vector2;
 using Vector3 = DirectX::SimpleMath::Vector3;
@@ -51,14 +79,29 @@ struct Vertex
     float _u, _v;
 };
 
-struct MatrixData
+struct BatchVertex
+{
+	float _x, _y, _z;
+	float _u, _v;
+	float _r, _g, _b, _a;
+};
+
+struct InstanceData
+{
+	Vector4 _axes;
+	Vector4 _translation;
+	Vector4 _uvRect;
+	Color _color;
+};
+
+struct ViewProjectionData
 {
-	Matrix _world;
-	Matrix _view;
-	Matrix _projection;
+	Matrix _viewProjection;
 };
 
+#ifdef _WIN32
 #define ASSERT_HR(__HR__) { HRESULT HR = __HR__; assert(SUCCEEDED(HR)); }
+#endif
 
 #define MAX(__X__, __Y__) (((__X__) > (__Y__)) ? (__X__) : (__Y__))
 #define MIN(__X__, __Y__) (((__X__) < (__Y__)) ? (__X__) : (__Y__))
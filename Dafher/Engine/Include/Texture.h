@@ -2,16 +2,35 @@
 #define __TEXTURE_H__
 
 #include "Stdafx.h"
+#include "TextureCompressor.h"
+#include "GraphicContext.h"
+
+struct TextureRegion
+{
+    class Texture* _texture;
+    Vector4 _uvRect;
+    uint32 _width;
+    uint32 _height;
+    bool _isAtlased;
+    bool _isResident;
+};
 
 class Texture
 {
 public:
     inline Texture() noexcept
-        : _width(0)
+        : _context(nullptr)
+        , _id(0)
+        , _width(0)
         , _height(0)
         , _originalWidth(0)
         , _originalHeight(0)
-        , _format(DXGI_FORMAT_UNKNOWN)
+        , _mipLevels(1)
+        , _mipGenerationTime(0.0f)
+        , _blockFormat(BlockFormat::None)
+        , _mappedData(nullptr)
+        , _mappedSize(0)
+        , _lastUsedFrame(0)
     {
     }
 
@@ -24,14 +43,24 @@ public:
     ~Texture() noexcept = default;
 
 public:
-    inline ID3D11ShaderResourceView* GetShaderResourceView() const noexcept
+    inline const GraphicTexture* GetGraphicTexture() const noexcept
     {
-        return _shaderResourceView.Get();
+        return _graphicTexture.get();
     }
 
-    inline ID3D11Texture2D* GetTexture2D() const noexcept
+    inline bool HasDeviceResources() const noexcept
     {
-        return _texture2D.Get();
+        return _graphicTexture != nullptr;
+    }
+
+    inline void SetId(uint32 id) noexcept
+    {
+        _id = id;
+    }
+
+    inline uint32 GetId() const noexcept
+    {
+        return _id;
     }
 
     inline uint32 GetWidth() const noexcept
@@ -44,37 +73,159 @@ public:
         return _height;
 	}
 
-    inline DXGI_FORMAT GetFormat() const noexcept
+    inline uint32 GetOriginalWidth() const noexcept
+    {
+        return _originalWidth;
+    }
+
+    inline uint32 GetOriginalHeight() const noexcept
     {
-        return _format;
+        return _originalHeight;
     }
 
     inline bool HasImageData() const noexcept
     {
-        return !_originalImageData.empty();
+        return GetPixels() != nullptr;
+    }
+
+    inline const unsigned char* GetPixels() const noexcept
+    {
+        if (IsCompressed())
+        {
+            return nullptr;
+        }
+
+        if (IsMapped())
+        {
+            return _mappedData;
+        }
+
+        return _originalImageData.empty() ? nullptr : _originalImageData.data();
+    }
+
+    inline size_t GetImageSize() const noexcept
+    {
+        return HasImageData() ? static_cast<size_t>(_originalWidth) * _originalHeight * 4 : 0;
+    }
+
+    inline uint32 GetMipLevels() const noexcept
+    {
+        return _mipLevels;
+    }
+
+    inline const unsigned char* GetMipPixels() const noexcept
+    {
+        return IsMapped() ? GetPixels() + GetImageSize() : _mipChainData.data();
+    }
+
+    inline size_t GetMipChainSize() const noexcept
+    {
+        return IsMapped() && !IsCompressed() ? _mappedSize - GetImageSize() : _mipChainData.size();
+    }
+
+    inline const uint8* GetBlockData() const noexcept
+    {
+        return IsMapped() ? _mappedData : _compressedData.data();
+    }
+
+    inline bool IsMapped() const noexcept
+    {
+        return _mappedData != nullptr;
+    }
+
+    inline bool IsCompressed() const noexcept
+    {
+        return _blockFormat != BlockFormat::None;
+    }
+
+    inline BlockFormat GetBlockFormat() const noexcept
+    {
+        return _blockFormat;
+    }
+
+    inline size_t GetMemorySize() const noexcept
+    {
+        if (IsMapped())
+        {
+            return _mappedSize;
+        }
+
+        return IsCompressed() ? _compressedData.size() : _originalImageData.size() + _mipChainData.size();
+    }
+
+    inline size_t GetCpuMemorySize() const noexcept
+    {
+        return IsMapped() ? 0 : GetMemorySize();
+    }
+
+    inline size_t GetGpuMemorySize() const noexcept
+    {
+        return HasDeviceResources() ? CalculateDataSize(_blockFormat, _width, _height, _mipLevels) : 0;
+    }
+
+    inline void MarkUsed(uint64 frameIndex) noexcept
+    {
+        _lastUsedFrame = frameIndex;
+    }
+
+    inline uint64 GetLastUsedFrame() const noexcept
+    {
+        return _lastUsedFrame;
+    }
+
+    inline float GetMipGenerationTime() const noexcept
+    {
+        return _mipGenerationTime;
     }
 
 public:
-    bool LoadFromFile(const ComPtr<ID3D11Device>& device, const std::wstring& filePath) noexcept;
-    bool Resize(uint32 width, uint32 height) noexcept;
+    bool LoadFromFile(GraphicContext* context, const std::filesystem::path& filePath) noexcept;
+    bool LoadImageFromFile(const std::filesystem::path& filePath) noexcept;
+    bool LoadImageFromMemory(const void* data, size_t dataSize) noexcept;
+    bool CreateFromImageData(GraphicContext* context,
+        std::vector<unsigned char>&& imageData, uint32 width, uint32 height) noexcept;
+    bool CreateDeviceResources(GraphicContext* context) noexcept;
+    bool CreateResized(GraphicContext* context, const Texture& source, uint32 width, uint32 height,
+        class ThreadPool* threadPool = nullptr) noexcept;
+    bool GenerateMips(class ThreadPool* threadPool = nullptr) noexcept;
+    void ReleaseImageData() noexcept;
+    void UpdateRegion(GraphicContext* context,
+        uint32 x, uint32 y, uint32 width, uint32 height, const uint8* data) noexcept;
+    void SetCompressedImage(CompressedImage&& image) noexcept;
+    bool SetMappedImage(const uint8* data, size_t dataSize, BlockFormat format,
+        uint32 width, uint32 height, uint32 mipLevels) noexcept;
+
+    static uint32 CalculateMipLevels(uint32 width, uint32 height) noexcept;
+    static size_t CalculateDataSize(BlockFormat format, uint32 width, uint32 height, uint32 mipLevels) noexcept;
 
 private:
     bool LoadImageData(const void* data, size_t dataSize) noexcept;
+    bool LoadDdsData(const void* data, size_t dataSize) noexcept;
+    void SetImageData(std::vector<unsigned char>&& imageData, uint32 width, uint32 height) noexcept;
     bool CreateTexture() noexcept;
-    bool CreateShaderResourceView() noexcept;
     
 private:
-    ComPtr<ID3D11Texture2D> _texture2D;
-    ComPtr<ID3D11ShaderResourceView> _shaderResourceView;
-    ComPtr<ID3D11Device> _device;
+    std::unique_ptr<GraphicTexture> _graphicTexture;
+    GraphicContext* _context;
 
     std::vector<unsigned char> _originalImageData;
     uint32 _originalWidth;
     uint32 _originalHeight;
 
+    std::vector<unsigned char> _mipChainData;
+    uint32 _mipLevels;
+    float _mipGenerationTime;
+
+    std::vector<uint8> _compressedData;
+    BlockFormat _blockFormat;
+
+    const uint8* _mappedData;
+    size_t _mappedSize;
+
+    uint64 _lastUsedFrame;
+    uint32 _id;
     uint32 _width;
     uint32 _height;
-    DXGI_FORMAT _format;
 };
 
 #endif
\ No newline at end of file
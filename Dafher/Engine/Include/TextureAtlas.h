@@ -0,0 +1,96 @@
+#ifndef __TEXTURE_ATLAS_H__
+#define __TEXTURE_ATLAS_H__
+
+#include "Stdafx.h"
+
+struct AtlasImage
+{
+	const uint8* _pixels;
+	uint32 _width;
+	uint32 _height;
+};
+
+struct AtlasPlacement
+{
+	uint32 _page;
+	uint32 _x;
+	uint32 _y;
+	bool _isPacked;
+};
+
+struct AtlasStats
+{
+	uint32 _pageCount;
+	uint32 _packedCount;
+	uint32 _rejectedCount;
+	uint64 _usedArea;
+	uint64 _pageArea;
+	float _efficiency;
+};
+
+class TextureAtlas
+{
+public:
+	TextureAtlas(uint32 pageSize = DEFAULT_PAGE_SIZE, uint32 padding = DEFAULT_PADDING) noexcept;
+
+	TextureAtlas(const TextureAtlas& textureAtlas) noexcept = delete;
+	TextureAtlas(TextureAtlas&& textureAtlas) noexcept = delete;
+	TextureAtlas& operator=(const TextureAtlas& textureAtlas) noexcept = delete;
+	TextureAtlas& operator=(TextureAtlas&& textureAtlas) noexcept = delete;
+
+public:
+	~TextureAtlas() noexcept = default;
+
+public:
+	bool Pack(const std::vector<AtlasImage>& images) noexcept;
+	bool Build(const std::vector<AtlasImage>& images) noexcept;
+	void Clear() noexcept;
+
+	Vector4 GetUVRect(size_t imageIndex) const noexcept;
+
+public:
+	inline uint32 GetPageSize() const noexcept
+	{
+		return _pageSize;
+	}
+
+	inline uint32 GetPageCount() const noexcept
+	{
+		return _stats._pageCount;
+	}
+
+	inline const std::vector<AtlasPlacement>& GetPlacements() const noexcept
+	{
+		return _placements;
+	}
+
+	inline std::vector<std::vector<uint8>>& GetPages() noexcept
+	{
+		return _pages;
+	}
+
+	inline const AtlasStats& GetStats() const noexcept
+	{
+		return _stats;
+	}
+
+private:
+	void Blit(std::vector<uint8>& page, const AtlasImage& image, uint32 x, uint32 y) const noexcept;
+
+public:
+	constexpr static uint32 DEFAULT_PAGE_SIZE = 2048;
+	constexpr static uint32 DEFAULT_PADDING = 1;
+
+private:
+	std::vector<AtlasPlacement> _placements;
+	std::vector<uint32> _imageSizes;
+	std::vector<std::vector<uint8>> _pages;
+
+	uint32 _maxPageSize;
+	uint32 _pageSize;
+	uint32 _padding;
+
+	AtlasStats _stats;
+};
+
+#endif
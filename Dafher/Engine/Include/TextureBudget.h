@@ -0,0 +1,119 @@
+#ifndef __TEXTURE_BUDGET_H__
+#define __TEXTURE_BUDGET_H__
+
+#include "Stdafx.h"
+#include "Texture.h"
+
+struct TextureMemoryStats
+{
+	uint32 _trackedCount;
+	uint32 _cpuResidentCount;
+	uint64 _cpuBytes;
+	uint64 _gpuBytes;
+	uint64 _gpuBudget;
+	uint32 _discardedCount;
+	uint64 _discardedBytes;
+	uint32 _evictedCount;
+	uint64 _evictedBytes;
+	uint32 _restreamedCount;
+};
+
+struct TextureEviction
+{
+	std::string _key;
+	uint64 _gpuBytes;
+	uint64 _frameIndex;
+	uint64 _idleFrames;
+};
+
+class TextureBudget
+{
+public:
+	inline TextureBudget() noexcept
+		: _frameIndex(0)
+		, _gpuBudget(DEFAULT_GPU_BUDGET)
+		, _stats()
+		, _isCpuDiscardEnabled(true)
+	{
+	}
+
+	TextureBudget(const TextureBudget& textureBudget) noexcept = delete;
+	TextureBudget(TextureBudget&& textureBudget) noexcept = delete;
+	TextureBudget& operator=(const TextureBudget& textureBudget) noexcept = delete;
+	TextureBudget& operator=(TextureBudget&& textureBudget) noexcept = delete;
+
+public:
+	~TextureBudget() noexcept = default;
+
+public:
+	void Register(const TextureRegion* region, const std::string& key) noexcept;
+	void Track(Texture* texture, TextureRegion* region) noexcept;
+	void Update(uint64 frameIndex, const class TextureVariantCache& variantCache,
+		std::vector<Texture*>& candidates) noexcept;
+	TextureRegion* Evict(Texture* texture) noexcept;
+	const std::string* Restore(const TextureRegion* region) noexcept;
+	const std::string* FindKey(const Texture* texture) const noexcept;
+	void Clear() noexcept;
+
+public:
+	inline void SetGpuBudget(uint64 gpuBudget) noexcept
+	{
+		_gpuBudget = gpuBudget;
+	}
+
+	inline uint64 GetGpuBudget() const noexcept
+	{
+		return _gpuBudget;
+	}
+
+	inline void SetCpuDiscardEnabled(bool isCpuDiscardEnabled) noexcept
+	{
+		_isCpuDiscardEnabled = isCpuDiscardEnabled;
+	}
+
+	inline bool IsCpuDiscardEnabled() const noexcept
+	{
+		return _isCpuDiscardEnabled;
+	}
+
+	inline uint64 GetFrameIndex() const noexcept
+	{
+		return _frameIndex;
+	}
+
+	inline const TextureMemoryStats& GetStats() const noexcept
+	{
+		return _stats;
+	}
+
+	inline const std::deque<TextureEviction>& GetEvictionLog() const noexcept
+	{
+		return _evictionLog;
+	}
+
+public:
+	constexpr static uint64 DEFAULT_GPU_BUDGET = 256 * 1024 * 1024;
+	constexpr static uint64 DISCARD_DELAY_FRAMES = 2;
+	constexpr static uint64 EVICTION_DELAY_FRAMES = 3;
+	constexpr static size_t MAX_EVICTION_LOG = 64;
+
+private:
+	struct TrackedTexture
+	{
+		TextureRegion* _region;
+		uint64 _trackFrame;
+	};
+
+private:
+	std::unordered_map<Texture*, TrackedTexture> _textures;
+	std::unordered_map<const TextureRegion*, std::string> _keys;
+	std::unordered_set<const TextureRegion*> _evictedRegions;
+	std::deque<TextureEviction> _evictionLog;
+
+	uint64 _frameIndex;
+	uint64 _gpuBudget;
+	TextureMemoryStats _stats;
+	bool _isCpuDiscardEnabled;
+};
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef __TEXTURE_COMPRESSOR_H__
+#define __TEXTURE_COMPRESSOR_H__
+
+#include "Stdafx.h"
+
+enum class BlockFormat : uint32
+{
+	None,
+	BC1,
+	BC2,
+	BC3,
+	BC4,
+	BC5,
+	BC7
+};
+
+struct CompressedImage
+{
+	std::vector<uint8> _data;
+	BlockFormat _format;
+	uint32 _width;
+	uint32 _height;
+	uint32 _mipLevels;
+	float _psnr;
+};
+
+struct CompressionStats
+{
+	uint32 _textureCount;
+	uint32 _cacheHitCount;
+	uint64 _sourceBytes;
+	uint64 _compressedBytes;
+	float _encodeTime;
+	float _averagePsnr;
+};
+
+class TextureCompressor
+{
+public:
+	TextureCompressor() noexcept = delete;
+
+public:
+	static bool Compress(const uint8* imageData, const uint8* mipChainData, uint32 width, uint32 height,
+		uint32 mipLevels, class ThreadPool* threadPool, CompressedImage& image) noexcept;
+	static bool LoadCache(const std::filesystem::path& cachePath, uint64 contentHash, CompressedImage& image) noexcept;
+	static bool SaveCache(const std::filesystem::path& cachePath, uint64 contentHash, const CompressedImage& image) noexcept;
+	static std::filesystem::path GetCachePath(const std::filesystem::path& cacheFolder, uint64 contentHash) noexcept;
+	static float CalculatePsnr(const uint8* imageData, uint32 width, uint32 height, const CompressedImage& image) noexcept;
+	static bool HasAlpha(const uint8* imageData, size_t pixelCount) noexcept;
+	static size_t GetLevelSize(BlockFormat format, uint32 width, uint32 height) noexcept;
+
+public:
+	inline static uint32 GetBlockSize(BlockFormat format) noexcept
+	{
+		return format == BlockFormat::BC1 || format == BlockFormat::BC4 ? 8 : 16;
+	}
+
+public:
+	constexpr static uint32 CACHE_MAGIC = 0x42464144;
+	constexpr static uint32 CACHE_VERSION = 1;
+	constexpr static float MAX_PSNR = 100.0f;
+
+private:
+	static void DecodeBlock(BlockFormat format, const uint8* block, uint8* pixels) noexcept;
+};
+
+#endif
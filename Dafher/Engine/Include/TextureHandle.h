@@ -0,0 +1,64 @@
+#ifndef __TEXTURE_HANDLE_H__
+#define __TEXTURE_HANDLE_H__
+
+#include "Stdafx.h"
+
+struct TextureKey
+{
+	constexpr TextureKey(const char* key) noexcept
+		: _name(key)
+		, _hash(Hash(_name))
+	{
+	}
+
+	constexpr TextureKey(std::string_view key) noexcept
+		: _name(key)
+		, _hash(Hash(key))
+	{
+	}
+
+	inline TextureKey(const std::string& key) noexcept
+		: _name(key)
+		, _hash(Hash(_name))
+	{
+	}
+
+	constexpr static uint64 Hash(std::string_view key) noexcept
+	{
+		uint64 hash = 14695981039346656037ull;
+
+		for (char c : key)
+		{
+			hash ^= static_cast<uint8>(c);
+			hash *= 1099511628211ull;
+		}
+
+		return hash;
+	}
+
+	std::string_view _name;
+	uint64 _hash;
+};
+
+struct TextureHandle
+{
+	uint32 _index;
+	uint32 _generation;
+
+	inline bool IsValid() const noexcept
+	{
+		return _generation != 0;
+	}
+
+	inline bool operator==(const TextureHandle& handle) const noexcept
+	{
+		return _index == handle._index && _generation == handle._generation;
+	}
+
+	inline bool operator!=(const TextureHandle& handle) const noexcept
+	{
+		return !(*this == handle);
+	}
+};
+
+#endif
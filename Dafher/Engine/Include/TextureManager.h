@@ -3,11 +3,55 @@
 
 #include "Stdafx.h"
 #include "Texture.h"
+#include "TextureAtlas.h"
+#include "AssetManifest.h"
+#include "AssetPack.h"
+#include "TextureStreamer.h"
+#include "TextureVariantCache.h"
+#include "TextureBudget.h"
+#include "TextureHandle.h"
+#include "Flipbook.h"
+#include "VirtualTexture.h"
+
+struct TextureSource
+{
+    std::string _key;
+    std::filesystem::path _filePath;
+    uint64 _contentHash;
+};
+
+struct TextureLoadStats
+{
+    uint32 _imageCount;
+    uint32 _threadCount;
+    float _manifestTime;
+    float _decodeTime;
+    float _atlasTime;
+    float _mipTime;
+    float _uploadTime;
+    float _totalTime;
+    uint64 _baseMemory;
+    uint64 _mipMemory;
+    uint32 _packImageCount;
+    uint32 _looseImageCount;
+    float _packLoadTime;
+    float _looseLoadTime;
+};
 
 class TextureManager
 {
 public:
-    TextureManager() noexcept = default;
+    inline TextureManager() noexcept
+        : _placeholder(nullptr)
+        , _nextTextureId(1)
+        , _atlasStats()
+        , _loadStats()
+        , _compressionStats()
+        , _isCompressionEnabled(false)
+        , _isPackEnabled(true)
+        , _context(nullptr)
+    {
+    }
 
 	TextureManager(const TextureManager& textureManager) noexcept = delete;
 	TextureManager(TextureManager&& textureManager) noexcept = delete;
@@ -18,25 +62,189 @@ public:
     ~TextureManager() noexcept = default;
 
 public:
-    bool Init(const ComPtr<ID3D11Device>& device) noexcept;
+    bool Init(GraphicContext* context) noexcept;
 	void Clear() noexcept;
+    const TextureRegion* GetTexture(const std::string& key) noexcept;
+    void Preload(const std::vector<std::string>& keys) noexcept;
+    void LoadPending() noexcept;
+    const Flipbook* GetFlipbook(const std::string& name) noexcept;
+    VirtualTexture* GetVirtualTexture(const std::string& key) noexcept;
+    const TextureRegion* RequestTexture(const std::string& key,
+        StreamPriority priority = StreamPriority::Visible) noexcept;
+    void Update() noexcept;
+    Texture* AcquireVariant(const Texture* source, uint32 width, uint32 height) noexcept;
+    void ReleaseVariant(const Texture* variant) noexcept;
+    TextureHandle GetHandle(const TextureKey& key) noexcept;
+    TextureHandle RequestHandle(const TextureKey& key, StreamPriority priority = StreamPriority::Visible) noexcept;
+    bool EnsureResident(const TextureRegion* region, StreamPriority priority = StreamPriority::Visible) noexcept;
 
 public:
-    inline Texture* GetTexture(const std::string& key) const noexcept
+    inline const TextureRegion* Resolve(TextureHandle handle) const noexcept
+    {
+        if (handle._index >= _slots.size() || _slots[handle._index]._generation != handle._generation)
+        {
+            return nullptr;
+        }
+
+        return _slots[handle._index]._region;
+    }
+
+    inline bool IsValid(TextureHandle handle) const noexcept
+    {
+        return Resolve(handle) != nullptr;
+    }
+
+    inline const AssetManifest& GetManifest() const noexcept
+    {
+        return _manifest;
+    }
+
+    inline const AssetPack& GetPack() const noexcept
     {
-        return _textures.at(key).get();
+        return _pack;
     }
 
+    inline void SetPackEnabled(bool isPackEnabled) noexcept
+    {
+        _isPackEnabled = isPackEnabled;
+    }
+
+    inline bool IsPackEnabled() const noexcept
+    {
+        return _isPackEnabled;
+    }
+
+    inline void SetUploadBudget(uint64 uploadBudget) noexcept
+    {
+        _streamer->SetUploadBudget(uploadBudget);
+    }
+
+    inline StreamingStats GetStreamingStats() const noexcept
+    {
+        return _streamer->GetStats();
+    }
+
+    inline TextureVariantCache& GetVariantCache() noexcept
+    {
+        return _variantCache;
+    }
+
+    inline TextureBudget& GetBudget() noexcept
+    {
+        return _budget;
+    }
+
+    inline const TextureMemoryStats& GetMemoryStats() const noexcept
+    {
+        return _budget.GetStats();
+    }
+
+    inline const std::deque<TextureEviction>& GetEvictionLog() const noexcept
+    {
+        return _budget.GetEvictionLog();
+    }
+
+    inline uint32 GetRetiredTextureCount() const noexcept
+    {
+        return static_cast<uint32>(_retiredTextures.size());
+    }
+
+    inline const AtlasStats& GetAtlasStats() const noexcept
+    {
+        return _atlasStats;
+    }
+
+    inline const TextureLoadStats& GetLoadStats() const noexcept
+    {
+        return _loadStats;
+    }
+
+    inline void SetCompressionEnabled(bool isCompressionEnabled) noexcept
+    {
+        _isCompressionEnabled = isCompressionEnabled;
+    }
+
+    inline bool IsCompressionEnabled() const noexcept
+    {
+        return _isCompressionEnabled;
+    }
+
+    inline const CompressionStats& GetCompressionStats() const noexcept
+    {
+        return _compressionStats;
+    }
+
+private:
+    void LoadAll(const std::vector<TextureSource>& sources) noexcept;
+    void UpdateBudget() noexcept;
+    void StreamTexture(TextureRegion* region, const std::string& key,
+        const AssetManifestEntry& entry, StreamPriority priority) noexcept;
+    bool LoadFromPack(Texture* texture, const std::string& key, uint64 contentHash) const noexcept;
+    bool LoadCompressed(Texture* texture, uint64 contentHash, float& psnr) noexcept;
+    bool RestoreImageData(const Texture* texture) noexcept;
+    bool CompressTexture(const std::string& key, Texture* texture, uint64 contentHash) noexcept;
+    void AddCompressionResult(const std::string& key, const Texture* texture, float psnr, bool isCached) noexcept;
+    Texture* AddTexture(std::unique_ptr<Texture> texture) noexcept;
+    void RemoveTexture(const Texture* texture) noexcept;
+    void RetireTexture(std::unique_ptr<Texture> texture) noexcept;
+    void RetireEvictedVariants() noexcept;
+    void ReleaseRetiredTextures() noexcept;
+    const TextureRegion* AddRegion(const std::string& key, Texture* texture) noexcept;
+    const TextureRegion* AddMissingRegion(const std::string& key) noexcept;
+    uint32 AllocateTextureId() noexcept;
+    TextureHandle FindHandle(const TextureKey& key) const noexcept;
+    TextureHandle AddHandle(const std::string& key, const TextureRegion* region) noexcept;
+
+public:
+    constexpr static uint32 MAX_ATLAS_IMAGE_SIZE = 256;
+    constexpr static const char* RESOURCE_PATH = "../Resources/";
+    constexpr static const char* MANIFEST_PATH = "../Resources/textures.manifest";
+    constexpr static const char* PACK_PATH = "../Resources/textures.pack";
+    constexpr static const char* COMPRESSION_CACHE_PATH = "../Cache/Textures/";
+    constexpr static const char* VIRTUAL_TEXTURE_PATH = "../Resources/VirtualTextures/";
+
 private:
-	void RecursiveLoad(const std::wstring& folderPath) noexcept;
-    Texture* Load(const std::string& key, const std::wstring& filePath) noexcept;
-    bool IsImageFile(const std::wstring& fileName) noexcept;
-    std::string GetFileNameWithoutExtension(const std::wstring& fileName) noexcept;
+    struct TextureSlot
+    {
+        const TextureRegion* _region;
+        std::string_view _key;
+        uint32 _generation;
+    };
+
+    struct RetiredTexture
+    {
+        std::unique_ptr<Texture> _texture;
+        uint64 _fenceFrame;
+    };
 
 private:
-    std::unordered_map<std::string, std::unique_ptr<Texture>> _textures;
+    std::unordered_map<std::string, TextureRegion> _regions;
+    std::unordered_map<std::string, std::unique_ptr<Flipbook>> _flipbooks;
+    std::unordered_map<std::string, std::unique_ptr<VirtualTexture>> _virtualTextures;
+    std::vector<TextureSlot> _slots;
+    std::vector<uint32> _freeSlots;
+    std::unordered_map<uint64, uint32> _slotIndices;
+    std::vector<std::unique_ptr<Texture>> _textures;
+    std::vector<StreamResult> _streamResults;
+    std::vector<std::string> _pendingKeys;
+    std::vector<Texture*> _evictionCandidates;
+    std::vector<std::unique_ptr<Texture>> _evictedVariants;
+    std::vector<RetiredTexture> _retiredTextures;
+    std::unique_ptr<TextureStreamer> _streamer;
+    Texture* _placeholder;
+    TextureVariantCache _variantCache;
+    TextureBudget _budget;
+    std::vector<uint32> _freeTextureIds;
+    uint32 _nextTextureId;
+    AssetManifest _manifest;
+    AssetPack _pack;
+    AtlasStats _atlasStats;
+    TextureLoadStats _loadStats;
+    CompressionStats _compressionStats;
+    bool _isCompressionEnabled;
+    bool _isPackEnabled;
 
-    ComPtr<ID3D11Device> _device;
+    GraphicContext* _context;
 };
 
-#endif
\ No newline at end of file
+#endif
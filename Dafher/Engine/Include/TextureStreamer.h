@@ -0,0 +1,104 @@
+#ifndef __TEXTURE_STREAMER_H__
+#define __TEXTURE_STREAMER_H__
+
+#include "Stdafx.h"
+#include "Texture.h"
+#include "FileIO.h"
+
+enum class StreamPriority : uint8
+{
+	Visible,
+	NearCamera,
+	Prefetch,
+	Count
+};
+
+struct StreamResult
+{
+	TextureRegion* _region;
+	std::unique_ptr<Texture> _texture;
+	std::chrono::steady_clock::time_point _requestTime;
+	StreamPriority _priority;
+};
+
+struct StreamingStats
+{
+	uint32 _queueDepth;
+	uint32 _decodingCount;
+	uint32 _readyCount;
+	uint32 _completedCount;
+	uint32 _failedCount;
+	uint32 _uploadCount;
+	uint64 _uploadBytes;
+	uint64 _uploadBudget;
+	uint32 _budgetOverrunCount;
+	uint64 _budgetOverrunBytes;
+	float _lastLatency;
+	float _averageLatency;
+	float _maxLatency;
+};
+
+class TextureStreamer
+{
+public:
+	TextureStreamer(FileIO* fileIO) noexcept;
+
+	TextureStreamer(const TextureStreamer& textureStreamer) noexcept = delete;
+	TextureStreamer(TextureStreamer&& textureStreamer) noexcept = delete;
+	TextureStreamer& operator=(const TextureStreamer& textureStreamer) noexcept = delete;
+	TextureStreamer& operator=(TextureStreamer&& textureStreamer) noexcept = delete;
+
+public:
+	~TextureStreamer() noexcept;
+
+public:
+	void Request(TextureRegion* region, const std::filesystem::path& filePath, StreamPriority priority) noexcept;
+	void Submit(TextureRegion* region, std::unique_ptr<Texture> texture, StreamPriority priority) noexcept;
+	void Collect(std::vector<StreamResult>& results) noexcept;
+	void CompleteUpload(const StreamResult& result) noexcept;
+	void Cancel() noexcept;
+	bool IsPending(const TextureRegion* region) const noexcept;
+	StreamingStats GetStats() const noexcept;
+
+public:
+	inline void SetUploadBudget(uint64 uploadBudget) noexcept
+	{
+		_uploadBudget = uploadBudget;
+	}
+
+	inline uint64 GetUploadBudget() const noexcept
+	{
+		return _uploadBudget;
+	}
+
+public:
+	constexpr static uint64 DEFAULT_UPLOAD_BUDGET = 4 * 1024 * 1024;
+
+private:
+	struct PendingStream
+	{
+		StreamPriority _priority;
+		uint64 _requestId;
+	};
+
+	void Decode(TextureRegion* region, std::chrono::steady_clock::time_point requestTime,
+		IoStatus status, IoBuffer& buffer) noexcept;
+
+private:
+	FileIO* _fileIO;
+
+	std::unordered_map<const TextureRegion*, PendingStream> _pendingRegions;
+	std::vector<StreamResult> _readyResults;
+
+	mutable std::mutex _mutex;
+	std::condition_variable _idleCondition;
+
+	uint32 _queuedCount;
+	uint32 _jobCount;
+	uint32 _decodingCount;
+	uint64 _uploadBudget;
+	uint64 _latencySampleCount;
+	StreamingStats _stats;
+};
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef __TEXTURE_VARIANT_CACHE_H__
+#define __TEXTURE_VARIANT_CACHE_H__
+
+#include "Stdafx.h"
+#include "Texture.h"
+
+struct VariantCacheStats
+{
+	uint32 _variantCount;
+	uint32 _unusedCount;
+	uint32 _hitCount;
+	uint32 _missCount;
+	uint32 _evictedCount;
+	uint64 _memoryBytes;
+	uint64 _unusedBytes;
+};
+
+class TextureVariantCache
+{
+public:
+	inline TextureVariantCache() noexcept
+		: _frameIndex(0)
+		, _maxUnusedBytes(DEFAULT_MAX_UNUSED_BYTES)
+		, _stats()
+	{
+	}
+
+	TextureVariantCache(const TextureVariantCache& textureVariantCache) noexcept = delete;
+	TextureVariantCache(TextureVariantCache&& textureVariantCache) noexcept = delete;
+	TextureVariantCache& operator=(const TextureVariantCache& textureVariantCache) noexcept = delete;
+	TextureVariantCache& operator=(TextureVariantCache&& textureVariantCache) noexcept = delete;
+
+public:
+	~TextureVariantCache() noexcept = default;
+
+public:
+	Texture* Acquire(GraphicContext* context, const Texture* source, uint32 width, uint32 height,
+		class ThreadPool* threadPool = nullptr) noexcept;
+	void Release(const Texture* variant) noexcept;
+	void Update(std::vector<std::unique_ptr<Texture>>& evictedTextures) noexcept;
+	bool RemoveSource(const Texture* source, std::vector<std::unique_ptr<Texture>>& evictedTextures) noexcept;
+	void Clear() noexcept;
+
+public:
+	inline void SetMaxUnusedBytes(uint64 maxUnusedBytes) noexcept
+	{
+		_maxUnusedBytes = maxUnusedBytes;
+	}
+
+	inline uint64 GetMaxUnusedBytes() const noexcept
+	{
+		return _maxUnusedBytes;
+	}
+
+	inline bool HasVariants(const Texture* source) const noexcept
+	{
+		return _sourceCounts.find(source) != _sourceCounts.end();
+	}
+
+	inline const VariantCacheStats& GetStats() const noexcept
+	{
+		return _stats;
+	}
+
+public:
+	constexpr static uint64 DEFAULT_MAX_UNUSED_BYTES = 16 * 1024 * 1024;
+	constexpr static uint64 EVICTION_DELAY_FRAMES = 2;
+
+private:
+	struct VariantKey
+	{
+		const Texture* _source;
+		uint32 _width;
+		uint32 _height;
+
+		inline bool operator==(const VariantKey& key) const noexcept
+		{
+			return _source == key._source && _width == key._width && _height == key._height;
+		}
+	};
+
+	struct VariantKeyHash
+	{
+		inline size_t operator()(const VariantKey& key) const noexcept
+		{
+			size_t hash = std::hash<const Texture*>()(key._source);
+			hash ^= (static_cast<size_t>(key._width) << 16 | key._height) + 0x9E3779B9 + (hash << 6) + (hash >> 2);
+
+			return hash;
+		}
+	};
+
+	struct VariantEntry
+	{
+		std::unique_ptr<Texture> _texture;
+		uint32 _refCount;
+		uint64 _releaseFrame;
+	};
+
+private:
+	void Erase(const VariantKey& key, std::vector<std::unique_ptr<Texture>>& evictedTextures) noexcept;
+
+private:
+	std::unordered_map<VariantKey, VariantEntry, VariantKeyHash> _entries;
+	std::unordered_map<const Texture*, VariantKey> _keys;
+	std::unordered_map<const Texture*, uint32> _sourceCounts;
+
+	uint64 _frameIndex;
+	uint64 _maxUnusedBytes;
+	VariantCacheStats _stats;
+};
+
+#endif
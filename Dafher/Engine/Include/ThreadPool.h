@@ -0,0 +1,44 @@
+#ifndef __THREAD_POOL_H__
+#define __THREAD_POOL_H__
+
+#include "Stdafx.h"
+
+class ThreadPool
+{
+public:
+	ThreadPool(uint32 threadCount = 0) noexcept;
+
+	ThreadPool(const ThreadPool& threadPool) noexcept = delete;
+	ThreadPool(ThreadPool&& threadPool) noexcept = delete;
+	ThreadPool& operator=(const ThreadPool& threadPool) noexcept = delete;
+	ThreadPool& operator=(ThreadPool&& threadPool) noexcept = delete;
+
+public:
+	~ThreadPool() noexcept;
+
+public:
+	void Enqueue(std::function<void()> task) noexcept;
+	void ParallelFor(uint32 count, const std::function<void(uint32)>& function) noexcept;
+	void Wait() noexcept;
+
+public:
+	inline uint32 GetThreadCount() const noexcept
+	{
+		return static_cast<uint32>(_threads.size());
+	}
+
+private:
+	void Run() noexcept;
+
+private:
+	std::vector<std::thread> _threads;
+	std::deque<std::function<void()>> _tasks;
+	std::mutex _mutex;
+	std::condition_variable _taskCondition;
+	std::condition_variable _idleCondition;
+
+	uint32 _activeCount;
+	bool _isStopping;
+};
+
+#endif
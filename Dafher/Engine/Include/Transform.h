@@ -14,6 +14,7 @@ protected:
         , _rotation(Quaternion::Identity)
         , _isLocalDirty(true)
         , _isWorldDirty(true)
+        , _worldVersion(0)
     {
     }
 
@@ -168,6 +169,11 @@ public:
         return _scale.z;
     }
 
+    inline uint32 GetWorldVersion() const noexcept
+    {
+        return _worldVersion;
+    }
+
     inline Vector3 GetLocalForward() const noexcept
     {
         return Vector3(0.0f, 1.0f, 0.0f);
@@ -212,6 +218,8 @@ private:
 
     mutable bool _isLocalDirty;
     mutable bool _isWorldDirty;
+
+    uint32 _worldVersion;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,110 @@
+#ifndef __VIRTUAL_SPRITE_H__
+#define __VIRTUAL_SPRITE_H__
+
+#include "Component.h"
+#include "QuadBatch.h"
+#include "VirtualTexture.h"
+
+class VirtualSprite : public Component
+{
+protected:
+	VirtualSprite(const std::string& textureKey) noexcept;
+
+	VirtualSprite(const VirtualSprite& virtualSprite) noexcept = delete;
+	VirtualSprite(VirtualSprite&& virtualSprite) noexcept = delete;
+	VirtualSprite& operator=(const VirtualSprite& virtualSprite) noexcept = delete;
+	VirtualSprite& operator=(VirtualSprite&& virtualSprite) noexcept = delete;
+
+public:
+	virtual ~VirtualSprite() noexcept override = default;
+
+public:
+	CREATE(VirtualSprite)
+
+public:
+	inline void SetSize(const Vector2& size) noexcept
+	{
+		_size = size;
+		_isWorldDirty = true;
+	}
+
+	inline const Vector2& GetSize() const noexcept
+	{
+		return _size;
+	}
+
+	inline void SetAnchorPoint(const Vector2& anchor) noexcept
+	{
+		_anchorPoint = anchor;
+		_isWorldDirty = true;
+	}
+
+	inline const Vector2& GetAnchorPoint() const noexcept
+	{
+		return _anchorPoint;
+	}
+
+	inline void SetColor(const Color& color) noexcept
+	{
+		_color = color;
+	}
+
+	inline const Color& GetColor() const noexcept
+	{
+		return _color;
+	}
+
+	inline void SetLayer(uint8 layer) noexcept
+	{
+		_layer = layer;
+	}
+
+	inline uint8 GetLayer() const noexcept
+	{
+		return _layer;
+	}
+
+	inline void SetBlendMode(BlendMode blendMode) noexcept
+	{
+		_blendMode = blendMode;
+	}
+
+	inline BlendMode GetBlendMode() const noexcept
+	{
+		return _blendMode;
+	}
+
+	inline VirtualTexture* GetVirtualTexture() const noexcept
+	{
+		return _virtualTexture;
+	}
+
+public:
+	virtual bool Init() override;
+	virtual void PreUpdate(float delta) override;
+	virtual void Update(float delta) override;
+	virtual void PostUpdate(float delta) override;
+	virtual bool GetWorldBounds(Bounds& bounds) const override;
+
+private:
+	void RefreshWorld() const noexcept;
+	void AddView(const Bounds& viewBounds, const Vector4& viewport, Bounds& visibleBounds, uint32& mip) const noexcept;
+
+private:
+	VirtualTexture* _virtualTexture;
+	std::vector<VirtualTileUpload> _uploads;
+
+	Color _color;
+	Vector2 _size;
+	Vector2 _anchorPoint;
+
+	uint8 _layer;
+	BlendMode _blendMode;
+
+	mutable Matrix _worldMatrix;
+	mutable Bounds _worldBounds;
+	mutable uint32 _cachedWorldVersion;
+	mutable bool _isWorldDirty;
+};
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef __VIRTUAL_TEXTURE_H__
+#define __VIRTUAL_TEXTURE_H__
+
+#include "Stdafx.h"
+#include "VirtualTextureFile.h"
+
+struct VirtualTextureStats
+{
+	uint32 _slotCount;
+	uint32 _residentCount;
+	uint32 _requestedCount;
+	uint32 _missingCount;
+	uint32 _fallbackCount;
+	uint32 _uploadedCount;
+	uint32 _evictedCount;
+	uint64 _uploadedBytes;
+};
+
+struct VirtualTileUpload
+{
+	uint32 _tileIndex;
+	uint32 _x;
+	uint32 _y;
+};
+
+class VirtualTexture
+{
+public:
+	VirtualTexture(uint32 slotsPerSide = DEFAULT_SLOTS_PER_SIDE) noexcept;
+
+	VirtualTexture(const VirtualTexture& virtualTexture) noexcept = delete;
+	VirtualTexture(VirtualTexture&& virtualTexture) noexcept = delete;
+	VirtualTexture& operator=(const VirtualTexture& virtualTexture) noexcept = delete;
+	VirtualTexture& operator=(VirtualTexture&& virtualTexture) noexcept = delete;
+
+public:
+	~VirtualTexture() noexcept;
+
+public:
+	bool Open(class GraphicContext* context, const std::filesystem::path& filePath) noexcept;
+	void Close() noexcept;
+	void BeginFrame(uint64 frameIndex) noexcept;
+	uint32 SelectMip(float texelsPerPixel) const noexcept;
+	void Request(const Vector4& uvRect, uint32 mip) noexcept;
+	void Update(uint32 maxUploads = MAX_UPLOADS_PER_FRAME) noexcept;
+	bool Resolve(uint32 mip, uint32 tileX, uint32 tileY, Vector4& uvRect) noexcept;
+	bool IsResident(uint32 mip, uint32 tileX, uint32 tileY) const noexcept;
+	void GetTileRange(const Vector4& uvRect, uint32 mip, uint32& x0, uint32& y0, uint32& x1, uint32& y1) const noexcept;
+	Vector4 GetTileRect(uint32 mip, uint32 tileX, uint32 tileY) const noexcept;
+	void TakeUploads(std::vector<VirtualTileUpload>& uploads) noexcept;
+
+public:
+	inline const VirtualTextureFile& GetFile() const noexcept
+	{
+		return _file;
+	}
+
+	inline class Texture* GetPhysicalTexture() const noexcept
+	{
+		return _physicalTexture.get();
+	}
+
+	inline uint32 GetSlotsPerSide() const noexcept
+	{
+		return _slotsPerSide;
+	}
+
+	inline uint64 GetFrameIndex() const noexcept
+	{
+		return _frameIndex;
+	}
+
+	inline const VirtualTextureStats& GetStats() const noexcept
+	{
+		return _stats;
+	}
+
+public:
+	constexpr static uint32 DEFAULT_SLOTS_PER_SIDE = 8;
+	constexpr static uint32 MAX_UPLOADS_PER_FRAME = 8;
+	constexpr static uint16 INVALID_SLOT = 0xFFFF;
+
+private:
+	struct TileSlot
+	{
+		uint32 _tileIndex;
+		uint64 _lastUsedFrame;
+		bool _isPinned;
+	};
+
+private:
+	bool LoadTile(uint32 tileIndex, bool isPinned) noexcept;
+	uint32 AllocateSlot() noexcept;
+
+private:
+	VirtualTextureFile _file;
+	std::unique_ptr<class Texture> _physicalTexture;
+
+	std::vector<uint16> _pageTable;
+	std::vector<uint8> _tileMips;
+	std::vector<TileSlot> _slots;
+	std::vector<uint32> _freeSlots;
+	std::vector<uint64> _requestFrames;
+	std::vector<uint32> _requests;
+	std::vector<VirtualTileUpload> _uploads;
+
+	uint64 _frameIndex;
+	uint32 _slotsPerSide;
+	VirtualTextureStats _stats;
+};
+
+#endif
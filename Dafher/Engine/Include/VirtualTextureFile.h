@@ -0,0 +1,133 @@
+#ifndef __VIRTUAL_TEXTURE_FILE_H__
+#define __VIRTUAL_TEXTURE_FILE_H__
+
+#include "Stdafx.h"
+#include "MappedFile.h"
+
+struct VirtualTextureHeader
+{
+	uint32 _magic;
+	uint32 _version;
+	uint32 _width;
+	uint32 _height;
+	uint32 _tileSize;
+	uint32 _border;
+	uint32 _mipLevels;
+	uint32 _tileCount;
+};
+
+class VirtualTextureFile
+{
+public:
+	inline VirtualTextureFile() noexcept
+		: _header(nullptr)
+	{
+	}
+
+	VirtualTextureFile(const VirtualTextureFile& virtualTextureFile) noexcept = delete;
+	VirtualTextureFile(VirtualTextureFile&& virtualTextureFile) noexcept = delete;
+	VirtualTextureFile& operator=(const VirtualTextureFile& virtualTextureFile) noexcept = delete;
+	VirtualTextureFile& operator=(VirtualTextureFile&& virtualTextureFile) noexcept = delete;
+
+public:
+	~VirtualTextureFile() noexcept = default;
+
+public:
+	bool Open(const std::filesystem::path& filePath) noexcept;
+	void Close() noexcept;
+
+	static bool Build(const std::filesystem::path& sourcePath, const std::filesystem::path& outputPath,
+		uint32 tileSize = DEFAULT_TILE_SIZE, uint32 border = DEFAULT_BORDER, class ThreadPool* threadPool = nullptr) noexcept;
+	static uint32 CalculateMipLevels(uint32 width, uint32 height, uint32 tileSize) noexcept;
+
+public:
+	inline bool IsOpen() const noexcept
+	{
+		return _header != nullptr;
+	}
+
+	inline uint32 GetWidth() const noexcept
+	{
+		return _header->_width;
+	}
+
+	inline uint32 GetHeight() const noexcept
+	{
+		return _header->_height;
+	}
+
+	inline uint32 GetTileSize() const noexcept
+	{
+		return _header->_tileSize;
+	}
+
+	inline uint32 GetBorder() const noexcept
+	{
+		return _header->_border;
+	}
+
+	inline uint32 GetPageSize() const noexcept
+	{
+		return _header->_tileSize + _header->_border * 2;
+	}
+
+	inline uint32 GetMipLevels() const noexcept
+	{
+		return _header->_mipLevels;
+	}
+
+	inline uint32 GetTileCount() const noexcept
+	{
+		return _header->_tileCount;
+	}
+
+	inline uint32 GetMipWidth(uint32 mip) const noexcept
+	{
+		return MAX(1u, _header->_width >> mip);
+	}
+
+	inline uint32 GetMipHeight(uint32 mip) const noexcept
+	{
+		return MAX(1u, _header->_height >> mip);
+	}
+
+	inline uint32 GetTilesX(uint32 mip) const noexcept
+	{
+		return (GetMipWidth(mip) + _header->_tileSize - 1) / _header->_tileSize;
+	}
+
+	inline uint32 GetTilesY(uint32 mip) const noexcept
+	{
+		return (GetMipHeight(mip) + _header->_tileSize - 1) / _header->_tileSize;
+	}
+
+	inline uint32 GetTileIndex(uint32 mip, uint32 x, uint32 y) const noexcept
+	{
+		return _mipOffsets[mip] + y * GetTilesX(mip) + x;
+	}
+
+	inline size_t GetTileBytes() const noexcept
+	{
+		return static_cast<size_t>(GetPageSize()) * GetPageSize() * 4;
+	}
+
+	inline const uint8* GetTileData(uint32 tileIndex) const noexcept
+	{
+		return _file.GetData() + DATA_OFFSET + tileIndex * GetTileBytes();
+	}
+
+public:
+	constexpr static uint32 MAGIC = 0x54564144;
+	constexpr static uint32 VERSION = 1;
+	constexpr static uint32 DEFAULT_TILE_SIZE = 248;
+	constexpr static uint32 DEFAULT_BORDER = 4;
+	constexpr static uint64 DATA_OFFSET = 64;
+	constexpr static const char* EXTENSION = ".vtex";
+
+private:
+	MappedFile _file;
+	const VirtualTextureHeader* _header;
+	std::vector<uint32> _mipOffsets;
+};
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef __WIN32_WINDOW_H__
+#define __WIN32_WINDOW_H__
+
+#include "Window.h"
+
+#ifdef _WIN32
+
+class Win32Window : public Window
+{
+public:
+	inline Win32Window() noexcept
+		: _hWnd(nullptr)
+	{
+	}
+
+	Win32Window(const Win32Window& window) noexcept = delete;
+	Win32Window(Win32Window&& window) noexcept = delete;
+	Win32Window& operator=(const Win32Window& window) noexcept = delete;
+	Win32Window& operator=(Win32Window&& window) noexcept = delete;
+
+public:
+	virtual ~Win32Window() noexcept override = default;
+
+public:
+	virtual bool Init() noexcept override;
+	virtual bool ProcessEvents() noexcept override;
+
+	virtual uint32 GetWidth() const noexcept override;
+	virtual uint32 GetHeight() const noexcept override;
+
+public:
+	virtual void* GetNativeHandle() const noexcept override
+	{
+		return _hWnd;
+	}
+
+	inline HWND GetHWnd() const noexcept
+	{
+		return _hWnd;
+	}
+
+private:
+	static LRESULT CALLBACK Procedure(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam) noexcept;
+
+private:
+	HWND _hWnd;
+};
+
+#endif
+
+#endif
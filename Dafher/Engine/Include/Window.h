@@ -6,33 +6,15 @@
 class Window
 {
 public:
-	inline Window() noexcept
-		: _hWnd(nullptr)
-	{
-	}
-
-	Window(const Window& window) noexcept = delete;
-	Window(Window&& window) noexcept = delete;
-	Window& operator=(const Window& window) noexcept = delete;
-	Window& operator=(Window&& window) noexcept = delete;
-
-public:
-	~Window() noexcept = default;
+	virtual ~Window() noexcept = default;
 
 public:
-	void Init() noexcept;
-
-public:
-	inline HWND GetHWnd() const noexcept
-	{
-		return _hWnd;
-	}
-
-private:
-	static LRESULT CALLBACK Procedure(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam) noexcept;
+	virtual bool Init() noexcept = 0;
+	virtual bool ProcessEvents() noexcept = 0;
 
-private:
-	HWND _hWnd;
+	virtual void* GetNativeHandle() const noexcept = 0;
+	virtual uint32 GetWidth() const noexcept = 0;
+	virtual uint32 GetHeight() const noexcept = 0;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,286 @@
+#include "AssetCooker.h"
+#include "AssetManifest.h"
+#include "AssetPack.h"
+#include "Platform.h"
+#include "Texture.h"
+#include "ThreadPool.h"
+
+bool AssetCooker::Cook(const std::filesystem::path& resourcePath, const std::filesystem::path& manifestPath,
+	const std::filesystem::path& packPath, const std::filesystem::path& cachePath) noexcept
+{
+	_stats = CookStats();
+	_stats._threadCount = _threadPool != nullptr ? _threadPool->GetThreadCount() : 1;
+
+	std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+	std::chrono::steady_clock::time_point phaseStart = startTime;
+
+	std::error_code errorCode;
+	std::filesystem::create_directories(cachePath, errorCode);
+
+	std::filesystem::path scratchPath = manifestPath;
+	scratchPath += ".tmp";
+
+	{
+		AssetManifest previous;
+		previous.Open(manifestPath);
+
+		if (!AssetManifest::Build(resourcePath, scratchPath, _threadPool, &previous))
+		{
+			return false;
+		}
+	}
+
+	std::filesystem::rename(scratchPath, manifestPath, errorCode);
+
+	AssetManifest manifest;
+
+	if (errorCode || !manifest.Open(manifestPath))
+	{
+		return false;
+	}
+
+	std::chrono::duration<float, std::milli> scanTime = std::chrono::steady_clock::now() - phaseStart;
+	phaseStart = std::chrono::steady_clock::now();
+
+	const uint32 assetCount = manifest.GetEntryCount();
+	const AssetManifestEntry* entries = manifest.GetEntries();
+
+	std::vector<CookedAssetHeader> headers(assetCount);
+	std::vector<std::filesystem::path> cookedPaths(assetCount);
+	std::vector<CookResult> results(assetCount, CookResult::Failed);
+
+	auto cook = [this, &manifest, &cachePath, entries, &headers, &cookedPaths, &results](uint32 index)
+	{
+		const uint64 cookKey = GetCookKey(entries[index]._contentHash);
+		cookedPaths[index] = GetCookedPath(cachePath, cookKey);
+
+		if (ReadCookedHeader(cookedPaths[index], cookKey, headers[index]))
+		{
+			results[index] = CookResult::Reused;
+			return;
+		}
+
+		results[index] = CookAsset(manifest.GetFilePath(entries[index]), cookedPaths[index], cookKey, headers[index]);
+	};
+
+	if (_threadPool != nullptr)
+	{
+		_threadPool->ParallelFor(assetCount, cook);
+	}
+	else
+	{
+		for (uint32 i = 0; i < assetCount; ++i)
+		{
+			cook(i);
+		}
+	}
+
+	std::vector<AssetPackSource> sources;
+	sources.reserve(assetCount);
+
+	for (uint32 i = 0; i < assetCount; ++i)
+	{
+		if (results[i] == CookResult::Failed)
+		{
+			_stats._failedCount++;
+
+			std::string failedMsg = "Cook failed: " + Platform::ToUtf8(manifest.GetFilePath(entries[i])) + "\n";
+			Platform::DebugOutput(failedMsg);
+			continue;
+		}
+
+		if (results[i] == CookResult::Reused)
+		{
+			_stats._reusedCount++;
+		}
+		else
+		{
+			_stats._cookedCount++;
+		}
+
+		AssetPackSource source;
+		source._key = std::string(manifest.GetKey(entries[i]));
+		source._contentHash = entries[i]._contentHash;
+		source._cookKey = headers[i]._cookKey;
+		source._width = headers[i]._width;
+		source._height = headers[i]._height;
+		source._mipLevels = headers[i]._mipLevels;
+		source._format = headers[i]._format;
+		source._payloadPath = cookedPaths[i];
+		source._payloadOffset = sizeof(CookedAssetHeader);
+		sources.push_back(std::move(source));
+	}
+
+	std::chrono::duration<float, std::milli> cookTime = std::chrono::steady_clock::now() - phaseStart;
+	phaseStart = std::chrono::steady_clock::now();
+
+	_stats._isPackUpToDate = IsPackUpToDate(packPath, sources);
+
+	if (!_stats._isPackUpToDate)
+	{
+		scratchPath = packPath;
+		scratchPath += ".tmp";
+
+		if (!AssetPack::Write(scratchPath, sources))
+		{
+			return false;
+		}
+
+		std::filesystem::rename(scratchPath, packPath, errorCode);
+
+		if (errorCode)
+		{
+			return false;
+		}
+	}
+
+	std::chrono::duration<float, std::milli> packTime = std::chrono::steady_clock::now() - phaseStart;
+	std::chrono::duration<float, std::milli> totalTime = std::chrono::steady_clock::now() - startTime;
+
+	_stats._assetCount = assetCount;
+	_stats._packSize = std::filesystem::file_size(packPath, errorCode);
+	_stats._scanTime = scanTime.count();
+	_stats._cookTime = cookTime.count();
+	_stats._packTime = packTime.count();
+	_stats._totalTime = totalTime.count();
+
+	std::string statsMsg = "Cook: " + std::to_string(_stats._assetCount) + " assets on " +
+		std::to_string(_stats._threadCount) + " threads, " +
+		std::to_string(_stats._cookedCount) + " cooked, " +
+		std::to_string(_stats._reusedCount) + " reused, " +
+		std::to_string(_stats._failedCount) + " failed, scan " +
+		std::to_string(_stats._scanTime) + " ms, cook " +
+		std::to_string(_stats._cookTime) + " ms, pack " +
+		std::to_string(_stats._packTime) + " ms" + (_stats._isPackUpToDate ? " (up to date)" : "") + ", total " +
+		std::to_string(_stats._totalTime) + " ms\n";
+	Platform::DebugOutput(statsMsg);
+
+	return _stats._failedCount == 0;
+}
+
+std::filesystem::path AssetCooker::GetCookedPath(const std::filesystem::path& cachePath, uint64 cookKey) noexcept
+{
+	char fileName[32];
+	snprintf(fileName, sizeof(fileName), "%016llx.cooked", static_cast<unsigned long long>(cookKey));
+
+	return cachePath / fileName;
+}
+
+CookResult AssetCooker::CookAsset(const std::filesystem::path& sourcePath, const std::filesystem::path& cookedPath,
+	uint64 cookKey, CookedAssetHeader& header) const noexcept
+{
+	Texture texture;
+
+	if (!texture.LoadImageFromFile(sourcePath) || !texture.GenerateMips())
+	{
+		return CookResult::Failed;
+	}
+
+	if (_isCompressionEnabled && !texture.IsCompressed() &&
+		texture.GetWidth() % 4 == 0 && texture.GetHeight() % 4 == 0)
+	{
+		CompressedImage image = {};
+
+		if (TextureCompressor::Compress(texture.GetPixels(), texture.GetMipPixels(),
+			texture.GetWidth(), texture.GetHeight(), texture.GetMipLevels(), nullptr, image))
+		{
+			texture.SetCompressedImage(std::move(image));
+		}
+	}
+
+	header = CookedAssetHeader{};
+	header._magic = COOKED_MAGIC;
+	header._version = COOKED_VERSION;
+	header._cookKey = cookKey;
+	header._width = texture.GetWidth();
+	header._height = texture.GetHeight();
+	header._mipLevels = texture.GetMipLevels();
+	header._format = texture.GetBlockFormat();
+	header._dataSize = texture.GetMemorySize();
+
+	std::filesystem::path scratchPath = cookedPath;
+	scratchPath += ".tmp";
+
+	{
+		std::ofstream file(scratchPath, std::ios::binary | std::ios::trunc);
+
+		if (!file.is_open())
+		{
+			return CookResult::Failed;
+		}
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+		if (texture.IsCompressed())
+		{
+			file.write(reinterpret_cast<const char*>(texture.GetBlockData()), static_cast<std::streamsize>(header._dataSize));
+		}
+		else
+		{
+			file.write(reinterpret_cast<const char*>(texture.GetPixels()), static_cast<std::streamsize>(texture.GetImageSize()));
+			file.write(reinterpret_cast<const char*>(texture.GetMipPixels()), static_cast<std::streamsize>(texture.GetMipChainSize()));
+		}
+
+		if (!file.good())
+		{
+			return CookResult::Failed;
+		}
+	}
+
+	std::error_code errorCode;
+	std::filesystem::rename(scratchPath, cookedPath, errorCode);
+
+	return errorCode ? CookResult::Failed : CookResult::Cooked;
+}
+
+uint64 AssetCooker::GetCookKey(uint64 contentHash) const noexcept
+{
+	const uint64 settings[] = { contentHash, COOKED_VERSION, _isCompressionEnabled ? 1ull : 0ull };
+
+	return AssetManifest::Hash(settings, sizeof(settings));
+}
+
+bool AssetCooker::IsPackUpToDate(const std::filesystem::path& packPath, const std::vector<AssetPackSource>& sources) const noexcept
+{
+	AssetPack pack;
+
+	if (!pack.Open(packPath) || pack.GetEntryCount() != sources.size())
+	{
+		return false;
+	}
+
+	for (const AssetPackSource& source : sources)
+	{
+		const AssetPackEntry* entry = pack.Find(source._key);
+
+		if (entry == nullptr || entry->_cookKey != source._cookKey || entry->_contentHash != source._contentHash)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool AssetCooker::ReadCookedHeader(const std::filesystem::path& cookedPath, uint64 cookKey, CookedAssetHeader& header) noexcept
+{
+	std::ifstream file(cookedPath, std::ios::binary | std::ios::ate);
+
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	const uint64 fileSize = static_cast<uint64>(file.tellg());
+	file.seekg(0, std::ios::beg);
+
+	if (fileSize < sizeof(header) || !file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+	{
+		return false;
+	}
+
+	return header._magic == COOKED_MAGIC && header._version == COOKED_VERSION && header._cookKey == cookKey &&
+		header._mipLevels > 0 && header._mipLevels <= Texture::CalculateMipLevels(header._width, header._height) &&
+		header._dataSize == Texture::CalculateDataSize(header._format, header._width, header._height, header._mipLevels) &&
+		fileSize == sizeof(header) + header._dataSize;
+}
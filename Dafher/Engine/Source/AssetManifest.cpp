@@ -0,0 +1,330 @@
+#include "AssetManifest.h"
+#include "Platform.h"
+#include "ThreadPool.h"
+#include "DdsFile.h"
+#include "FileIO.h"
+
+#include "stb_image.h"
+
+bool AssetManifest::Open(const std::filesystem::path& manifestPath) noexcept
+{
+	Close();
+
+	if (!_file.Open(manifestPath) || _file.GetSize() < sizeof(AssetManifestHeader))
+	{
+		Close();
+		return false;
+	}
+
+	const AssetManifestHeader* header = reinterpret_cast<const AssetManifestHeader*>(_file.GetData());
+	const uint64 expectedSize = sizeof(AssetManifestHeader) +
+		static_cast<uint64>(header->_entryCount) * sizeof(AssetManifestEntry) + header->_stringTableSize;
+
+	if (header->_magic != MAGIC || header->_version != VERSION || _file.GetSize() != expectedSize)
+	{
+		Close();
+		return false;
+	}
+
+	_header = header;
+	_entries = reinterpret_cast<const AssetManifestEntry*>(_file.GetData() + sizeof(AssetManifestHeader));
+	_strings = reinterpret_cast<const char*>(_entries + header->_entryCount);
+	_folderPath = manifestPath.parent_path();
+
+	return true;
+}
+
+void AssetManifest::Close() noexcept
+{
+	_file.Close();
+	_folderPath.clear();
+
+	_header = nullptr;
+	_entries = nullptr;
+	_strings = nullptr;
+}
+
+const AssetManifestEntry* AssetManifest::Find(std::string_view key) const noexcept
+{
+	if (_header == nullptr)
+	{
+		return nullptr;
+	}
+
+	const uint64 keyHash = Hash(key.data(), key.size());
+	const AssetManifestEntry* end = _entries + _header->_entryCount;
+	const AssetManifestEntry* it = std::lower_bound(_entries, end, keyHash,
+		[](const AssetManifestEntry& entry, uint64 hash)
+		{
+			return entry._keyHash < hash;
+		});
+
+	for (; it != end && it->_keyHash == keyHash; ++it)
+	{
+		if (GetKey(*it) == key)
+		{
+			return it;
+		}
+	}
+
+	return nullptr;
+}
+
+std::filesystem::path AssetManifest::GetFilePath(const AssetManifestEntry& entry) const noexcept
+{
+	std::string_view path = GetRelativePath(entry);
+
+	return _folderPath / std::filesystem::u8path(path.begin(), path.end());
+}
+
+bool AssetManifest::Validate(const std::filesystem::path& folderPath, std::vector<std::string>& staleKeys) const noexcept
+{
+	std::vector<std::filesystem::path> files;
+	Platform::EnumerateFiles(folderPath, files);
+
+	std::unordered_set<std::string> seenKeys;
+
+	// Only the size and write time are compared, so validation stats every asset without reading it.
+	for (const std::filesystem::path& filePath : files)
+	{
+		std::string key = Platform::ToUtf8(filePath.stem());
+
+		if (GetFormat(filePath) == AssetFormat::Unknown || !seenKeys.insert(key).second)
+		{
+			continue;
+		}
+
+		std::error_code error;
+		const AssetManifestEntry* entry = Find(key);
+		const uint64 fileSize = std::filesystem::file_size(filePath, error);
+		const uint64 writeTime = static_cast<uint64>(std::filesystem::last_write_time(filePath, error).time_since_epoch().count());
+
+		if (entry == nullptr || error || entry->_fileSize != fileSize || entry->_writeTime != writeTime ||
+			GetRelativePath(*entry) != std::filesystem::relative(filePath, _folderPath).generic_u8string())
+		{
+			staleKeys.push_back(std::move(key));
+		}
+	}
+
+	for (uint32 i = 0; i < GetEntryCount(); ++i)
+	{
+		std::string key(GetKey(_entries[i]));
+
+		if (seenKeys.find(key) == seenKeys.end())
+		{
+			staleKeys.push_back(std::move(key));
+		}
+	}
+
+	return IsOpen() && staleKeys.empty();
+}
+
+bool AssetManifest::Build(const std::filesystem::path& folderPath, const std::filesystem::path& manifestPath,
+	ThreadPool* threadPool, const AssetManifest* previous) noexcept
+{
+	std::vector<std::filesystem::path> files;
+	Platform::EnumerateFiles(folderPath, files);
+
+	std::vector<std::filesystem::path> assetFiles;
+	std::vector<std::string> keys;
+	std::vector<std::string> paths;
+	std::unordered_set<std::string> seenKeys;
+
+	for (const std::filesystem::path& filePath : files)
+	{
+		std::string key = Platform::ToUtf8(filePath.stem());
+
+		if (GetFormat(filePath) != AssetFormat::Unknown && seenKeys.insert(key).second)
+		{
+			assetFiles.push_back(filePath);
+			keys.push_back(std::move(key));
+			paths.push_back(std::filesystem::relative(filePath, manifestPath.parent_path()).generic_u8string());
+		}
+	}
+
+	std::vector<AssetManifestEntry> entries(assetFiles.size());
+
+	std::vector<uint8> isContentNeeded(assetFiles.size(), 0);
+
+	auto describe = [&assetFiles, &keys, &paths, &entries, &isContentNeeded, previous](uint32 index)
+	{
+		AssetManifestEntry& entry = entries[index];
+		entry = AssetManifestEntry{};
+		entry._format = GetFormat(assetFiles[index]);
+
+		std::error_code error;
+		entry._fileSize = std::filesystem::file_size(assetFiles[index], error);
+		entry._writeTime = static_cast<uint64>(std::filesystem::last_write_time(assetFiles[index], error).time_since_epoch().count());
+
+		const AssetManifestEntry* previousEntry = previous != nullptr ? previous->Find(keys[index]) : nullptr;
+
+		if (previousEntry != nullptr && !error && previous->GetRelativePath(*previousEntry) == paths[index] &&
+			previousEntry->_fileSize == entry._fileSize && previousEntry->_writeTime == entry._writeTime)
+		{
+			entry._contentHash = previousEntry->_contentHash;
+			entry._width = previousEntry->_width;
+			entry._height = previousEntry->_height;
+
+			return;
+		}
+
+		isContentNeeded[index] = 1;
+	};
+
+	auto describeContent = [&entries](uint32 index, const IoBuffer& buffer)
+	{
+		AssetManifestEntry& entry = entries[index];
+		entry._contentHash = Hash(buffer.GetData(), static_cast<size_t>(buffer.GetSize()));
+
+		if (entry._format == AssetFormat::Dds)
+		{
+			DdsImage ddsImage = {};
+
+			if (DdsFile::Parse(buffer.GetData(), static_cast<size_t>(buffer.GetSize()), ddsImage))
+			{
+				entry._width = ddsImage._width;
+				entry._height = ddsImage._height;
+			}
+
+			return;
+		}
+
+		int width = 0;
+		int height = 0;
+		int channels = 0;
+
+		if (stbi_info_from_memory(buffer.GetData(), static_cast<int>(buffer.GetSize()), &width, &height, &channels))
+		{
+			entry._width = static_cast<uint32>(width);
+			entry._height = static_cast<uint32>(height);
+		}
+	};
+
+	if (threadPool != nullptr)
+	{
+		threadPool->ParallelFor(static_cast<uint32>(entries.size()), describe);
+
+		FileIO fileIO(threadPool);
+		std::vector<IoRequest> requests;
+
+		for (uint32 i = 0; i < static_cast<uint32>(entries.size()); ++i)
+		{
+			if (isContentNeeded[i])
+			{
+				requests.push_back({ assetFiles[i], [&describeContent, i](IoStatus status, IoBuffer& buffer)
+					{
+						if (status == IoStatus::Completed)
+						{
+							describeContent(i, buffer);
+						}
+					}, IoPriority::Normal, IoMode::Auto });
+			}
+		}
+
+		fileIO.SubmitBatch(requests);
+		fileIO.Wait();
+	}
+	else
+	{
+		for (uint32 i = 0; i < static_cast<uint32>(entries.size()); ++i)
+		{
+			describe(i);
+
+			IoBuffer buffer;
+
+			if (isContentNeeded[i] && buffer.Load(assetFiles[i]))
+			{
+				describeContent(i, buffer);
+			}
+		}
+	}
+
+	std::string strings;
+
+	for (size_t i = 0; i < entries.size(); ++i)
+	{
+		const std::string& path = paths[i];
+
+		entries[i]._keyHash = Hash(keys[i].data(), keys[i].size());
+		entries[i]._keyOffset = static_cast<uint32>(strings.size());
+		entries[i]._keyLength = static_cast<uint32>(keys[i].size());
+		strings += keys[i];
+
+		entries[i]._pathOffset = static_cast<uint32>(strings.size());
+		entries[i]._pathLength = static_cast<uint32>(path.size());
+		strings += path;
+	}
+
+	std::stable_sort(entries.begin(), entries.end(),
+		[](const AssetManifestEntry& lhs, const AssetManifestEntry& rhs)
+		{
+			return lhs._keyHash < rhs._keyHash;
+		});
+
+	AssetManifestHeader header;
+	header._magic = MAGIC;
+	header._version = VERSION;
+	header._entryCount = static_cast<uint32>(entries.size());
+	header._stringTableSize = static_cast<uint32>(strings.size());
+
+	std::ofstream file(manifestPath, std::ios::binary | std::ios::trunc);
+
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	file.write(reinterpret_cast<const char*>(entries.data()), sizeof(AssetManifestEntry) * entries.size());
+	file.write(strings.data(), strings.size());
+
+	return file.good();
+}
+
+uint64 AssetManifest::Hash(const void* data, size_t size) noexcept
+{
+	const uint8* bytes = static_cast<const uint8*>(data);
+	uint64 hash = 14695981039346656037ull;
+
+	for (size_t i = 0; i < size; ++i)
+	{
+		hash ^= bytes[i];
+		hash *= 1099511628211ull;
+	}
+
+	return hash;
+}
+
+AssetFormat AssetManifest::GetFormat(const std::filesystem::path& filePath) noexcept
+{
+	std::string ext = Platform::ToUtf8(filePath.extension());
+	std::transform(ext.begin(), ext.end(), ext.begin(),
+		[](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+	if (ext == ".png")
+	{
+		return AssetFormat::Png;
+	}
+
+	if (ext == ".jpg" || ext == ".jpeg")
+	{
+		return AssetFormat::Jpeg;
+	}
+
+	if (ext == ".bmp")
+	{
+		return AssetFormat::Bmp;
+	}
+
+	if (ext == ".tga")
+	{
+		return AssetFormat::Tga;
+	}
+
+	if (ext == ".dds")
+	{
+		return AssetFormat::Dds;
+	}
+
+	return AssetFormat::Unknown;
+}
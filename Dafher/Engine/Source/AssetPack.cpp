@@ -0,0 +1,193 @@
+#include "AssetPack.h"
+#include "AssetManifest.h"
+#include "Texture.h"
+
+static inline uint64 AlignOffset(uint64 offset) noexcept
+{
+	return (offset + AssetPack::ALIGNMENT - 1) & ~(AssetPack::ALIGNMENT - 1);
+}
+
+static inline void WritePadding(std::ofstream& file, uint64& offset) noexcept
+{
+	static const char padding[AssetPack::ALIGNMENT] = {};
+
+	const uint64 alignedOffset = AlignOffset(offset);
+	file.write(padding, static_cast<std::streamsize>(alignedOffset - offset));
+	offset = alignedOffset;
+}
+
+bool AssetPack::Open(const std::filesystem::path& packPath) noexcept
+{
+	Close();
+
+	if (!_file.Open(packPath) || _file.GetSize() < sizeof(AssetPackHeader))
+	{
+		Close();
+		return false;
+	}
+
+	const uint64 fileSize = _file.GetSize();
+	const AssetPackHeader* header = reinterpret_cast<const AssetPackHeader*>(_file.GetData());
+	const uint64 tableEnd = ALIGNMENT + static_cast<uint64>(header->_entryCount) * sizeof(AssetPackEntry);
+
+	if (header->_magic != MAGIC || header->_version != VERSION || tableEnd > fileSize ||
+		header->_stringTableOffset < tableEnd || header->_stringTableOffset > fileSize ||
+		header->_stringTableSize > fileSize - header->_stringTableOffset)
+	{
+		Close();
+		return false;
+	}
+
+	const AssetPackEntry* entries = reinterpret_cast<const AssetPackEntry*>(_file.GetData() + ALIGNMENT);
+
+	for (uint32 i = 0; i < header->_entryCount; ++i)
+	{
+		const AssetPackEntry& entry = entries[i];
+
+		if (static_cast<uint64>(entry._keyOffset) + entry._keyLength > header->_stringTableSize ||
+			entry._dataOffset < header->_dataOffset || entry._dataOffset % ALIGNMENT != 0 ||
+			entry._dataOffset > fileSize || entry._dataSize > fileSize - entry._dataOffset ||
+			entry._mipLevels == 0 || entry._mipLevels > Texture::CalculateMipLevels(entry._width, entry._height) ||
+			entry._dataSize != Texture::CalculateDataSize(entry._format, entry._width, entry._height, entry._mipLevels))
+		{
+			Close();
+			return false;
+		}
+	}
+
+	_header = header;
+	_entries = entries;
+	_strings = reinterpret_cast<const char*>(_file.GetData() + header->_stringTableOffset);
+
+	return true;
+}
+
+void AssetPack::Close() noexcept
+{
+	_file.Close();
+
+	_header = nullptr;
+	_entries = nullptr;
+	_strings = nullptr;
+}
+
+const AssetPackEntry* AssetPack::Find(std::string_view key) const noexcept
+{
+	if (_header == nullptr)
+	{
+		return nullptr;
+	}
+
+	const uint64 keyHash = AssetManifest::Hash(key.data(), key.size());
+	const AssetPackEntry* end = _entries + _header->_entryCount;
+	const AssetPackEntry* it = std::lower_bound(_entries, end, keyHash,
+		[](const AssetPackEntry& entry, uint64 hash)
+		{
+			return entry._keyHash < hash;
+		});
+
+	for (; it != end && it->_keyHash == keyHash; ++it)
+	{
+		if (GetKey(*it) == key)
+		{
+			return it;
+		}
+	}
+
+	return nullptr;
+}
+
+bool AssetPack::Write(const std::filesystem::path& packPath, const std::vector<AssetPackSource>& sources) noexcept
+{
+	std::vector<AssetPackEntry> entries(sources.size());
+	std::vector<uint32> order(sources.size());
+	std::string strings;
+
+	for (uint32 i = 0; i < static_cast<uint32>(sources.size()); ++i)
+	{
+		const AssetPackSource& source = sources[i];
+		AssetPackEntry& entry = entries[i];
+
+		entry = AssetPackEntry{};
+		entry._keyHash = AssetManifest::Hash(source._key.data(), source._key.size());
+		entry._contentHash = source._contentHash;
+		entry._cookKey = source._cookKey;
+		entry._dataSize = Texture::CalculateDataSize(source._format, source._width, source._height, source._mipLevels);
+		entry._keyOffset = static_cast<uint32>(strings.size());
+		entry._keyLength = static_cast<uint32>(source._key.size());
+		entry._width = source._width;
+		entry._height = source._height;
+		entry._mipLevels = source._mipLevels;
+		entry._format = source._format;
+
+		strings += source._key;
+		order[i] = i;
+	}
+
+	std::stable_sort(order.begin(), order.end(),
+		[&entries](uint32 lhs, uint32 rhs)
+		{
+			return entries[lhs]._keyHash < entries[rhs]._keyHash;
+		});
+
+	AssetPackHeader header = {};
+	header._magic = MAGIC;
+	header._version = VERSION;
+	header._entryCount = static_cast<uint32>(entries.size());
+	header._stringTableOffset = ALIGNMENT + static_cast<uint64>(entries.size()) * sizeof(AssetPackEntry);
+	header._stringTableSize = static_cast<uint32>(strings.size());
+	header._dataOffset = AlignOffset(header._stringTableOffset + header._stringTableSize);
+
+	std::vector<AssetPackEntry> table;
+	table.reserve(entries.size());
+
+	uint64 dataOffset = header._dataOffset;
+
+	for (uint32 index : order)
+	{
+		entries[index]._dataOffset = dataOffset;
+		dataOffset = AlignOffset(dataOffset + entries[index]._dataSize);
+		table.push_back(entries[index]);
+	}
+
+	std::ofstream file(packPath, std::ios::binary | std::ios::trunc);
+
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	uint64 offset = sizeof(header);
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	WritePadding(file, offset);
+
+	file.write(reinterpret_cast<const char*>(table.data()), sizeof(AssetPackEntry) * table.size());
+	file.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+
+	offset = header._stringTableOffset + header._stringTableSize;
+	WritePadding(file, offset);
+
+	std::vector<char> buffer;
+
+	for (uint32 index : order)
+	{
+		const AssetPackSource& source = sources[index];
+		const AssetPackEntry& entry = entries[index];
+
+		std::ifstream payloadFile(source._payloadPath, std::ios::binary);
+		buffer.resize(static_cast<size_t>(entry._dataSize));
+
+		if (!payloadFile.is_open() || !payloadFile.seekg(static_cast<std::streamoff>(source._payloadOffset)) ||
+			!payloadFile.read(buffer.data(), static_cast<std::streamsize>(buffer.size())))
+		{
+			return false;
+		}
+
+		file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+
+		offset += entry._dataSize;
+		WritePadding(file, offset);
+	}
+
+	return file.good();
+}
@@ -0,0 +1,167 @@
+#include "Camera.h"
+#include "Node.h"
+#include "Engine.h"
+#include "Renderer.h"
+
+Camera::~Camera() noexcept
+{
+	Engine::GetInstance()->GetRenderer()->RemoveCamera(this);
+}
+
+bool Camera::Init()
+{
+	Engine::GetInstance()->GetRenderer()->AddCamera(this);
+
+	return true;
+}
+
+void Camera::SetViewport(float x, float y, float width, float height) noexcept
+{
+	_viewport = Vector4(x, y, width, height);
+	_isProjectionDirty = true;
+}
+
+void Camera::SetZoom(float zoom) noexcept
+{
+	assert(zoom > 0.0f);
+
+	_zoom = zoom;
+	_isProjectionDirty = true;
+}
+
+void Camera::SetClipPlanes(float nearPlane, float farPlane) noexcept
+{
+	_nearPlane = nearPlane;
+	_farPlane = farPlane;
+	_isProjectionDirty = true;
+}
+
+const Matrix& Camera::GetViewMatrix() const noexcept
+{
+	Refresh();
+
+	return _viewMatrix;
+}
+
+const Matrix& Camera::GetProjectionMatrix() const noexcept
+{
+	Refresh();
+
+	return _projectionMatrix;
+}
+
+const Matrix& Camera::GetViewProjectionMatrix() const noexcept
+{
+	Refresh();
+
+	return _viewProjectionMatrix;
+}
+
+const Bounds& Camera::GetViewBounds() const noexcept
+{
+	Refresh();
+
+	return _viewBounds;
+}
+
+Vector4 Camera::GetPixelViewport() const noexcept
+{
+	const Vector2& screenSize = Engine::GetInstance()->GetRenderer()->GetScreenSize();
+
+	return Vector4(
+		_viewport.x * screenSize.x,
+		_viewport.y * screenSize.y,
+		_viewport.z * screenSize.x,
+		_viewport.w * screenSize.y
+	);
+}
+
+void Camera::UpdateViewMatrix() const noexcept
+{
+	Vector3 position = Vector3::Zero;
+	Vector3 upVector = Vector3(0.0f, 1.0f, 0.0f);
+
+	if (_owner != nullptr && _owner->_transform != nullptr)
+	{
+		const Matrix& worldMatrix = _owner->_transform->GetWorldMatrix();
+
+		position = worldMatrix.Translation();
+		upVector = Vector3(worldMatrix._21, worldMatrix._22, 0.0f);
+		upVector.Normalize();
+	}
+
+	Vector3 cameraPosition = Vector3(position.x, position.y, position.z + _distance);
+	Vector3 targetPosition = Vector3(position.x, position.y, position.z);
+
+	_viewMatrix = DirectX::XMMatrixLookAtLH(
+		DirectX::XMLoadFloat3(reinterpret_cast<const DirectX::XMFLOAT3*>(&cameraPosition)),
+		DirectX::XMLoadFloat3(reinterpret_cast<const DirectX::XMFLOAT3*>(&targetPosition)),
+		DirectX::XMLoadFloat3(reinterpret_cast<const DirectX::XMFLOAT3*>(&upVector))
+	);
+}
+
+void Camera::UpdateProjectionMatrix() const noexcept
+{
+	float halfWidth = _viewport.z * _screenSize.x / (2.0f * _zoom);
+	float halfHeight = _viewport.w * _screenSize.y / (2.0f * _zoom);
+
+	_projectionMatrix = DirectX::XMMatrixOrthographicOffCenterLH(
+		halfWidth, -halfWidth,
+		-halfHeight, halfHeight,
+		_nearPlane, _farPlane
+	);
+}
+
+void Camera::Refresh() const noexcept
+{
+	const Vector2& screenSize = Engine::GetInstance()->GetRenderer()->GetScreenSize();
+
+	if (_screenSize != screenSize)
+	{
+		_screenSize = screenSize;
+		_isProjectionDirty = true;
+	}
+
+	if (_owner != nullptr && _owner->_transform != nullptr &&
+		_owner->_transform->GetWorldVersion() != _cachedWorldVersion)
+	{
+		_cachedWorldVersion = _owner->_transform->GetWorldVersion();
+		_isViewDirty = true;
+	}
+
+	if (!_isViewDirty && !_isProjectionDirty)
+	{
+		return;
+	}
+
+	if (_isViewDirty)
+	{
+		UpdateViewMatrix();
+		_isViewDirty = false;
+	}
+
+	if (_isProjectionDirty)
+	{
+		UpdateProjectionMatrix();
+		_isProjectionDirty = false;
+	}
+
+	_viewProjectionMatrix = _viewMatrix * _projectionMatrix;
+
+	Matrix inverseViewProjection = _viewProjectionMatrix.Invert();
+	const Vector3 corners[] =
+	{
+		Vector3(-1.0f, -1.0f, 0.0f),
+		Vector3(1.0f, -1.0f, 0.0f),
+		Vector3(-1.0f, 1.0f, 0.0f),
+		Vector3(1.0f, 1.0f, 0.0f)
+	};
+
+	_viewBounds = Bounds();
+
+	for (const Vector3& corner : corners)
+	{
+		Vector3 worldCorner = Vector3::Transform(corner, inverseViewProjection);
+		_viewBounds.Merge(Vector2(worldCorner.x, worldCorner.y));
+	}
+}
@@ -0,0 +1,531 @@
+#include "D3D11GraphicContext.h"
+#include "Texture.h"
+
+#ifdef _WIN32
+
+static inline DXGI_FORMAT ToDxgiFormat(BlockFormat format) noexcept
+{
+    switch (format)
+    {
+    case BlockFormat::BC1:
+        return DXGI_FORMAT_BC1_UNORM;
+    case BlockFormat::BC2:
+        return DXGI_FORMAT_BC2_UNORM;
+    case BlockFormat::BC3:
+        return DXGI_FORMAT_BC3_UNORM;
+    case BlockFormat::BC4:
+        return DXGI_FORMAT_BC4_UNORM;
+    case BlockFormat::BC5:
+        return DXGI_FORMAT_BC5_UNORM;
+    case BlockFormat::BC7:
+        return DXGI_FORMAT_BC7_UNORM;
+    default:
+        return DXGI_FORMAT_R8G8B8A8_UNORM;
+    }
+}
+
+static inline const D3D11GraphicTexture* GetGraphicTexture(const Texture* texture) noexcept
+{
+    return static_cast<const D3D11GraphicTexture*>(texture->GetGraphicTexture());
+}
+
+bool D3D11GraphicContext::CreateResources(uint32 maxQuads, uint32 maxInstances) noexcept
+{
+    return CreateBatchShaders() && CreateInstanceShaders() && CreateBuffers() &&
+        CreateBatchBuffers(maxQuads) && CreateInstanceBuffers(maxInstances) && CreateStates();
+}
+
+std::unique_ptr<GraphicTexture> D3D11GraphicContext::CreateTexture(const Texture& texture) noexcept
+{
+    const uint32 width = texture.GetWidth();
+    const uint32 height = texture.GetHeight();
+    const uint32 mipLevels = texture.GetMipLevels();
+    const DXGI_FORMAT format = ToDxgiFormat(texture.GetBlockFormat());
+
+    D3D11_TEXTURE2D_DESC textureDesc = {};
+    textureDesc.Width = width;
+    textureDesc.Height = height;
+    textureDesc.MipLevels = mipLevels;
+    textureDesc.ArraySize = 1;
+    textureDesc.Format = format;
+    textureDesc.SampleDesc.Count = 1;
+    textureDesc.SampleDesc.Quality = 0;
+    textureDesc.Usage = D3D11_USAGE_DEFAULT;
+    textureDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+    textureDesc.CPUAccessFlags = 0;
+    textureDesc.MiscFlags = 0;
+
+    std::vector<D3D11_SUBRESOURCE_DATA> initData(mipLevels);
+
+    if (texture.IsCompressed())
+    {
+        const uint8* levelData = texture.GetBlockData();
+
+        for (uint32 level = 0; level < mipLevels; ++level)
+        {
+            const uint32 mipWidth = MAX(1u, width >> level);
+            const uint32 mipHeight = MAX(1u, height >> level);
+
+            initData[level].pSysMem = levelData;
+            initData[level].SysMemPitch = ((mipWidth + 3) / 4) * TextureCompressor::GetBlockSize(texture.GetBlockFormat());
+            initData[level].SysMemSlicePitch = 0;
+
+            levelData += TextureCompressor::GetLevelSize(texture.GetBlockFormat(), mipWidth, mipHeight);
+        }
+    }
+    else
+    {
+        initData[0].pSysMem = texture.GetPixels();
+        initData[0].SysMemPitch = width * 4;
+        initData[0].SysMemSlicePitch = 0;
+
+        const unsigned char* mipData = texture.GetMipPixels();
+
+        for (uint32 level = 1; level < mipLevels; ++level)
+        {
+            const uint32 mipWidth = MAX(1u, width >> level);
+            const uint32 mipHeight = MAX(1u, height >> level);
+
+            initData[level].pSysMem = mipData;
+            initData[level].SysMemPitch = mipWidth * 4;
+            initData[level].SysMemSlicePitch = 0;
+
+            mipData += static_cast<size_t>(mipWidth) * mipHeight * 4;
+        }
+    }
+
+    ComPtr<ID3D11Texture2D> texture2D;
+    ASSERT_HR(_device->CreateTexture2D(&textureDesc, initData.data(), &texture2D));
+
+    D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+    srvDesc.Format = format;
+    srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+    srvDesc.Texture2D.MipLevels = mipLevels;
+    srvDesc.Texture2D.MostDetailedMip = 0;
+
+    ComPtr<ID3D11ShaderResourceView> shaderResourceView;
+    ASSERT_HR(_device->CreateShaderResourceView(texture2D.Get(), &srvDesc, &shaderResourceView));
+
+    return std::make_unique<D3D11GraphicTexture>(std::move(texture2D), std::move(shaderResourceView));
+}
+
+void D3D11GraphicContext::SetViewport(const Vector4& viewport) noexcept
+{
+    D3D11_VIEWPORT d3dViewport;
+    d3dViewport.TopLeftX = viewport.x;
+    d3dViewport.TopLeftY = viewport.y;
+    d3dViewport.Width = viewport.z;
+    d3dViewport.Height = viewport.w;
+    d3dViewport.MinDepth = 0.0f;
+    d3dViewport.MaxDepth = 1.0f;
+    _deviceContext->RSSetViewports(1, &d3dViewport);
+}
+
+void D3D11GraphicContext::UpdateBuffer(GraphicBuffer buffer, const void* data, size_t dataSize) noexcept
+{
+    ID3D11Buffer* d3dBuffer = GetBuffer(buffer);
+
+    D3D11_MAPPED_SUBRESOURCE mappedResource;
+    ASSERT_HR(_deviceContext->Map(d3dBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource));
+    memcpy(mappedResource.pData, data, dataSize);
+    _deviceContext->Unmap(d3dBuffer, 0);
+}
+
+void D3D11GraphicContext::UpdateTexture(Texture* texture,
+    uint32 x, uint32 y, uint32 width, uint32 height, const uint8* data) noexcept
+{
+    const D3D11GraphicTexture* graphicTexture = GetGraphicTexture(texture);
+
+    if (graphicTexture == nullptr)
+    {
+        return;
+    }
+
+    D3D11_BOX box = {};
+    box.left = x;
+    box.top = y;
+    box.front = 0;
+    box.right = x + width;
+    box.bottom = y + height;
+    box.back = 1;
+
+    _deviceContext->UpdateSubresource(graphicTexture->GetTexture2D(), 0, &box, data, static_cast<UINT>(width * 4), 0);
+}
+
+void D3D11GraphicContext::SetRasterizerState() noexcept
+{
+    _deviceContext->RSSetState(_rasterizerState.Get());
+}
+
+void D3D11GraphicContext::SetBlendState(BlendMode blendMode) noexcept
+{
+    const float blendFactor[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    _deviceContext->OMSetBlendState(_blendStates[static_cast<size_t>(blendMode)].Get(), blendFactor, 0xffffffff);
+}
+
+void D3D11GraphicContext::SetVertexShader(GraphicShader shader) noexcept
+{
+    _deviceContext->VSSetShader(_vertexShaders[static_cast<size_t>(shader)].Get(), nullptr, 0);
+}
+
+void D3D11GraphicContext::SetPixelShader(GraphicShader shader) noexcept
+{
+    _deviceContext->PSSetShader(_pixelShaders[static_cast<size_t>(shader)].Get(), nullptr, 0);
+}
+
+void D3D11GraphicContext::SetInputLayout(GraphicInputLayout inputLayout) noexcept
+{
+    _deviceContext->IASetInputLayout(_inputLayouts[static_cast<size_t>(inputLayout)].Get());
+}
+
+void D3D11GraphicContext::SetConstantBuffer(GraphicBuffer buffer) noexcept
+{
+    ID3D11Buffer* constantBuffer = GetBuffer(buffer);
+    _deviceContext->VSSetConstantBuffers(0, 1, &constantBuffer);
+}
+
+void D3D11GraphicContext::SetSampler() noexcept
+{
+    _deviceContext->PSSetSamplers(0, 1, _samplerState.GetAddressOf());
+}
+
+void D3D11GraphicContext::SetTopology() noexcept
+{
+    _deviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+}
+
+void D3D11GraphicContext::SetVertexBuffer(uint32 slot, GraphicBuffer buffer, uint32 stride) noexcept
+{
+    ID3D11Buffer* vertexBuffer = GetBuffer(buffer);
+    UINT offset = 0;
+    _deviceContext->IASetVertexBuffers(slot, 1, &vertexBuffer, &stride, &offset);
+}
+
+void D3D11GraphicContext::SetIndexBuffer(GraphicBuffer buffer) noexcept
+{
+    const DXGI_FORMAT format = buffer == GraphicBuffer::BatchIndex ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT;
+    _deviceContext->IASetIndexBuffer(GetBuffer(buffer), format, 0);
+}
+
+void D3D11GraphicContext::SetTexture(const Texture* texture) noexcept
+{
+    const D3D11GraphicTexture* graphicTexture = GetGraphicTexture(texture);
+    ID3D11ShaderResourceView* shaderResourceView = graphicTexture != nullptr ? graphicTexture->GetShaderResourceView() : nullptr;
+    _deviceContext->PSSetShaderResources(0, 1, &shaderResourceView);
+}
+
+void D3D11GraphicContext::DrawIndexed(uint32 indexCount, uint32 firstIndex) noexcept
+{
+    _deviceContext->DrawIndexed(indexCount, firstIndex, 0);
+}
+
+void D3D11GraphicContext::DrawIndexedInstanced(uint32 indexCount, uint32 instanceCount, uint32 firstInstance) noexcept
+{
+    _deviceContext->DrawIndexedInstanced(indexCount, instanceCount, 0, 0, firstInstance);
+}
+
+uint64 D3D11GraphicContext::GetTextureBinding(const Texture* texture) const noexcept
+{
+    const D3D11GraphicTexture* graphicTexture = GetGraphicTexture(texture);
+
+    return static_cast<uint64>(reinterpret_cast<uintptr_t>(
+        graphicTexture != nullptr ? graphicTexture->GetShaderResourceView() : nullptr));
+}
+
+bool D3D11GraphicContext::CreateBatchShaders() noexcept
+{
+    const char* vertexShaderSource = R"(
+        cbuffer ViewProjectionBuffer : register(b0)
+        {
+            matrix ViewProjection;
+        };
+
+        struct VS_INPUT
+        {
+            float3 Position : POSITION;
+            float2 TexCoord : TEXCOORD;
+            float4 Color : COLOR;
+        };
+
+        struct PS_INPUT
+        {
+            float4 Position : SV_POSITION;
+            float2 TexCoord : TEXCOORD;
+            float4 Color : COLOR;
+        };
+
+        PS_INPUT main(VS_INPUT input)
+        {
+            PS_INPUT output;
+
+            output.Position = mul(float4(input.Position, 1.0f), ViewProjection);
+            output.TexCoord = input.TexCoord;
+            output.Color = input.Color;
+
+            return output;
+        }
+    )";
+
+    ComPtr<ID3DBlob> vertexShaderBlob;
+    ComPtr<ID3DBlob> errorBlob;
+
+    ASSERT_HR(D3DCompile(vertexShaderSource, strlen(vertexShaderSource),
+        nullptr, nullptr, nullptr, "main", "vs_5_0", D3DCOMPILE_ENABLE_STRICTNESS,
+        0, &vertexShaderBlob, &errorBlob));
+
+    ASSERT_HR(_device->CreateVertexShader(vertexShaderBlob->GetBufferPointer(),
+        vertexShaderBlob->GetBufferSize(), nullptr, &_vertexShaders[static_cast<size_t>(GraphicShader::BatchVertex)]));
+
+    D3D11_INPUT_ELEMENT_DESC layout[] =
+    {
+        { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+        { "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+        { "COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 20, D3D11_INPUT_PER_VERTEX_DATA, 0 }
+    };
+
+    ASSERT_HR(_device->CreateInputLayout(layout, ARRAYSIZE(layout),
+        vertexShaderBlob->GetBufferPointer(), vertexShaderBlob->GetBufferSize(), &_inputLayouts[static_cast<size_t>(GraphicInputLayout::Batch)]));
+
+    const char* pixelShaderSource = R"(
+        Texture2D MainTexture : register(t0);
+        SamplerState MainSampler : register(s0);
+
+        struct PS_INPUT
+        {
+            float4 Position : SV_POSITION;
+            float2 TexCoord : TEXCOORD;
+            float4 Color : COLOR;
+        };
+
+        float4 main(PS_INPUT input) : SV_TARGET
+        {
+            return MainTexture.Sample(MainSampler, input.TexCoord) * input.Color;
+        }
+    )";
+
+    ComPtr<ID3DBlob> pixelShaderBlob;
+
+    ASSERT_HR(D3DCompile(pixelShaderSource, strlen(pixelShaderSource),
+        nullptr, nullptr, nullptr, "main", "ps_5_0",
+        D3DCOMPILE_ENABLE_STRICTNESS, 0, &pixelShaderBlob, &errorBlob));
+
+    ASSERT_HR(_device->CreatePixelShader(pixelShaderBlob->GetBufferPointer(),
+        pixelShaderBlob->GetBufferSize(), nullptr, &_pixelShaders[static_cast<size_t>(GraphicShader::SpritePixel)]));
+
+    return true;
+}
+
+bool D3D11GraphicContext::CreateInstanceShaders() noexcept
+{
+    const char* vertexShaderSource = R"(
+        cbuffer ViewProjectionBuffer : register(b0)
+        {
+            matrix ViewProjection;
+        };
+
+        struct VS_INPUT
+        {
+            float3 Position : POSITION;
+            float2 TexCoord : TEXCOORD0;
+            float4 Axes : INSTANCE_AXES;
+            float4 Translation : INSTANCE_TRANSLATION;
+            float4 UVRect : INSTANCE_UVRECT;
+            float4 Color : COLOR;
+        };
+
+        struct PS_INPUT
+        {
+            float4 Position : SV_POSITION;
+            float2 TexCoord : TEXCOORD;
+            float4 Color : COLOR;
+        };
+
+        PS_INPUT main(VS_INPUT input)
+        {
+            PS_INPUT output;
+
+            float3 worldPos = float3(
+                input.Position.x * input.Axes.x + input.Position.y * input.Axes.z + input.Translation.x,
+                input.Position.x * input.Axes.y + input.Position.y * input.Axes.w + input.Translation.y,
+                input.Translation.z);
+
+            output.Position = mul(float4(worldPos, 1.0f), ViewProjection);
+            output.TexCoord = lerp(input.UVRect.xy, input.UVRect.zw, input.TexCoord);
+            output.Color = input.Color;
+
+            return output;
+        }
+    )";
+
+    ComPtr<ID3DBlob> vertexShaderBlob;
+    ComPtr<ID3DBlob> errorBlob;
+
+    ASSERT_HR(D3DCompile(vertexShaderSource, strlen(vertexShaderSource),
+        nullptr, nullptr, nullptr, "main", "vs_5_0", D3DCOMPILE_ENABLE_STRICTNESS,
+        0, &vertexShaderBlob, &errorBlob));
+
+    ASSERT_HR(_device->CreateVertexShader(vertexShaderBlob->GetBufferPointer(),
+        vertexShaderBlob->GetBufferSize(), nullptr, &_vertexShaders[static_cast<size_t>(GraphicShader::InstanceVertex)]));
+
+    D3D11_INPUT_ELEMENT_DESC layout[] =
+    {
+        { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+        { "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+        { "INSTANCE_AXES", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 0, D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+        { "INSTANCE_TRANSLATION", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 16, D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+        { "INSTANCE_UVRECT", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 32, D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+        { "COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 48, D3D11_INPUT_PER_INSTANCE_DATA, 1 }
+    };
+
+    ASSERT_HR(_device->CreateInputLayout(layout, ARRAYSIZE(layout),
+        vertexShaderBlob->GetBufferPointer(), vertexShaderBlob->GetBufferSize(), &_inputLayouts[static_cast<size_t>(GraphicInputLayout::Instance)]));
+
+    return true;
+}
+
+bool D3D11GraphicContext::CreateBuffers() noexcept
+{
+    Vertex vertices[] = {
+        { 0.0f, 1.0f, 0.0f, 0.0f, 0.0f },
+        { 1.0f, 1.0f, 0.0f, 1.0f, 0.0f },
+        { 1.0f, 0.0f, 0.0f, 1.0f, 1.0f },
+        { 0.0f, 0.0f, 0.0f, 0.0f, 1.0f } 
+    };
+
+    D3D11_BUFFER_DESC vertexBufferDesc = {};
+    vertexBufferDesc.Usage = D3D11_USAGE_DEFAULT;
+    vertexBufferDesc.ByteWidth = sizeof(vertices);
+    vertexBufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+    vertexBufferDesc.CPUAccessFlags = 0;
+
+    D3D11_SUBRESOURCE_DATA vertexBufferData = {};
+    vertexBufferData.pSysMem = vertices;
+
+    ASSERT_HR(_device->CreateBuffer(&vertexBufferDesc, &vertexBufferData, &_buffers[static_cast<size_t>(GraphicBuffer::QuadVertex)]));
+
+    uint32 indices[] = {
+        0, 1, 2,
+        0, 2, 3
+    };
+
+    D3D11_BUFFER_DESC indexBufferDesc = {};
+    indexBufferDesc.Usage = D3D11_USAGE_DEFAULT;
+    indexBufferDesc.ByteWidth = sizeof(indices);
+    indexBufferDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
+    indexBufferDesc.CPUAccessFlags = 0;
+
+    D3D11_SUBRESOURCE_DATA indexBufferData = {};
+    indexBufferData.pSysMem = indices;
+
+    ASSERT_HR(_device->CreateBuffer(&indexBufferDesc, &indexBufferData, &_buffers[static_cast<size_t>(GraphicBuffer::QuadIndex)]));
+
+    return true;
+}
+
+bool D3D11GraphicContext::CreateBatchBuffers(uint32 maxQuads) noexcept
+{
+    assert(maxQuads * 4 <= 0x10000);
+
+    D3D11_BUFFER_DESC vertexBufferDesc = {};
+    vertexBufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+    vertexBufferDesc.ByteWidth = sizeof(BatchVertex) * 4 * maxQuads;
+    vertexBufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+    vertexBufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+    ASSERT_HR(_device->CreateBuffer(&vertexBufferDesc, nullptr, &_buffers[static_cast<size_t>(GraphicBuffer::BatchVertex)]));
+
+    std::vector<uint16> indices(static_cast<size_t>(maxQuads) * 6);
+
+    for (uint32 i = 0; i < maxQuads; ++i)
+    {
+        const uint16 baseVertex = static_cast<uint16>(i * 4);
+        uint16* index = &indices[static_cast<size_t>(i) * 6];
+
+        index[0] = baseVertex;
+        index[1] = baseVertex + 1;
+        index[2] = baseVertex + 2;
+        index[3] = baseVertex;
+        index[4] = baseVertex + 2;
+        index[5] = baseVertex + 3;
+    }
+
+    D3D11_BUFFER_DESC indexBufferDesc = {};
+    indexBufferDesc.Usage = D3D11_USAGE_IMMUTABLE;
+    indexBufferDesc.ByteWidth = static_cast<UINT>(sizeof(uint16) * indices.size());
+    indexBufferDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
+    indexBufferDesc.CPUAccessFlags = 0;
+
+    D3D11_SUBRESOURCE_DATA indexBufferData = {};
+    indexBufferData.pSysMem = indices.data();
+
+    ASSERT_HR(_device->CreateBuffer(&indexBufferDesc, &indexBufferData, &_buffers[static_cast<size_t>(GraphicBuffer::BatchIndex)]));
+
+    D3D11_BUFFER_DESC constantBufferDesc = {};
+    constantBufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+    constantBufferDesc.ByteWidth = sizeof(ViewProjectionData);
+    constantBufferDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+    constantBufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+    ASSERT_HR(_device->CreateBuffer(&constantBufferDesc, nullptr, &_buffers[static_cast<size_t>(GraphicBuffer::ViewProjection)]));
+
+    return true;
+}
+
+bool D3D11GraphicContext::CreateInstanceBuffers(uint32 maxInstances) noexcept
+{
+    D3D11_BUFFER_DESC instanceBufferDesc = {};
+    instanceBufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+    instanceBufferDesc.ByteWidth = sizeof(InstanceData) * maxInstances;
+    instanceBufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+    instanceBufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+    ASSERT_HR(_device->CreateBuffer(&instanceBufferDesc, nullptr, &_buffers[static_cast<size_t>(GraphicBuffer::Instance)]));
+
+    return true;
+}
+
+bool D3D11GraphicContext::CreateStates() noexcept
+{
+    D3D11_RASTERIZER_DESC rasterizerDesc = {};
+    rasterizerDesc.FillMode = D3D11_FILL_SOLID;
+    rasterizerDesc.CullMode = D3D11_CULL_NONE;
+    rasterizerDesc.FrontCounterClockwise = FALSE;
+    rasterizerDesc.DepthClipEnable = TRUE;
+
+    ASSERT_HR(_device->CreateRasterizerState(&rasterizerDesc, &_rasterizerState));
+
+    D3D11_SAMPLER_DESC samplerDesc = {};
+    samplerDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
+    samplerDesc.AddressU = D3D11_TEXTURE_ADDRESS_CLAMP;
+    samplerDesc.AddressV = D3D11_TEXTURE_ADDRESS_CLAMP;
+    samplerDesc.AddressW = D3D11_TEXTURE_ADDRESS_CLAMP;
+    samplerDesc.MipLODBias = 0.0f;
+    samplerDesc.MaxAnisotropy = 1;
+    samplerDesc.ComparisonFunc = D3D11_COMPARISON_NEVER;
+    samplerDesc.MinLOD = 0.0f;
+    samplerDesc.MaxLOD = D3D11_FLOAT32_MAX;
+
+    ASSERT_HR(_device->CreateSamplerState(&samplerDesc, &_samplerState));
+
+    D3D11_BLEND_DESC blendDesc = {};
+    blendDesc.AlphaToCoverageEnable = FALSE;
+    blendDesc.IndependentBlendEnable = FALSE;
+    blendDesc.RenderTarget[0].BlendEnable = TRUE;
+    blendDesc.RenderTarget[0].SrcBlend = D3D11_BLEND_SRC_ALPHA;
+    blendDesc.RenderTarget[0].DestBlend = D3D11_BLEND_INV_SRC_ALPHA;
+    blendDesc.RenderTarget[0].BlendOp = D3D11_BLEND_OP_ADD;
+    blendDesc.RenderTarget[0].SrcBlendAlpha = D3D11_BLEND_ONE;
+    blendDesc.RenderTarget[0].DestBlendAlpha = D3D11_BLEND_ZERO;
+    blendDesc.RenderTarget[0].BlendOpAlpha = D3D11_BLEND_OP_ADD;
+    blendDesc.RenderTarget[0].RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL;
+
+    ASSERT_HR(_device->CreateBlendState(&blendDesc, &_blendStates[static_cast<size_t>(BlendMode::Alpha)]));
+
+    blendDesc.RenderTarget[0].DestBlend = D3D11_BLEND_ONE;
+
+    ASSERT_HR(_device->CreateBlendState(&blendDesc, &_blendStates[static_cast<size_t>(BlendMode::Additive)]));
+
+    return true;
+}
+
+#endif
\ No newline at end of file
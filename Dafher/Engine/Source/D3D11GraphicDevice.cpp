@@ -1,13 +1,17 @@
-﻿#include "GraphicDevice.h"
+﻿#include "D3D11GraphicDevice.h"
+#include "Window.h"
 
-bool GraphicDevice::Init(HWND hWnd) noexcept
+#ifdef _WIN32
+
+bool D3D11GraphicDevice::Init(Window* window) noexcept
 {
-    RECT rect;
-    GetClientRect(hWnd, &rect);
-    UINT width = rect.right - rect.left;
-    UINT height = rect.bottom - rect.top;
+    assert(window != nullptr);
+
+    HWND hWnd = static_cast<HWND>(window->GetNativeHandle());
+    UINT width = window->GetWidth();
+    UINT height = window->GetHeight();
 
-    _aspectRatio = static_cast<float>(width) / static_cast<float>(height);
+    SetSize(width, height);
 
     DXGI_SWAP_CHAIN_DESC swapChainDesc = {};
     swapChainDesc.BufferCount = 1;
@@ -45,22 +49,31 @@ bool GraphicDevice::Init(HWND hWnd) noexcept
     viewport.TopLeftY = 0.0f;
     _context->RSSetViewports(1, &viewport);
 
+    _graphicContext = std::make_unique<D3D11GraphicContext>(_device, _context);
+
     return true;
 }
 
-void GraphicDevice::BeginFrame() noexcept
+void D3D11GraphicDevice::BeginFrame() noexcept
 {
 	const float clearColor[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
 
     _context->ClearRenderTargetView(_renderTargetView.Get(), clearColor);
 }
 
-void GraphicDevice::EndFrame() noexcept
+void D3D11GraphicDevice::EndFrame() noexcept
 {
     _swapChain->Present(0, 0);
 }
 
-void GraphicDevice::Clear() noexcept
+void D3D11GraphicDevice::Clear() noexcept
 {
     _context->ClearState();
-}
\ No newline at end of file
+}
+
+GraphicContext* D3D11GraphicDevice::GetContext() const noexcept
+{
+    return _graphicContext.get();
+}
+
+#endif
\ No newline at end of file
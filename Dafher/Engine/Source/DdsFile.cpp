@@ -0,0 +1,269 @@
+#include "DdsFile.h"
+
+struct DdsPixelFormat
+{
+	uint32 _size;
+	uint32 _flags;
+	uint32 _fourCC;
+	uint32 _rgbBitCount;
+	uint32 _redMask;
+	uint32 _greenMask;
+	uint32 _blueMask;
+	uint32 _alphaMask;
+};
+
+struct DdsHeader
+{
+	uint32 _size;
+	uint32 _flags;
+	uint32 _height;
+	uint32 _width;
+	uint32 _pitchOrLinearSize;
+	uint32 _depth;
+	uint32 _mipMapCount;
+	uint32 _reserved1[11];
+	DdsPixelFormat _pixelFormat;
+	uint32 _caps;
+	uint32 _caps2;
+	uint32 _caps3;
+	uint32 _caps4;
+	uint32 _reserved2;
+};
+
+struct DdsHeaderDx10
+{
+	uint32 _dxgiFormat;
+	uint32 _resourceDimension;
+	uint32 _miscFlag;
+	uint32 _arraySize;
+	uint32 _miscFlags2;
+};
+
+constexpr uint32 DDPF_ALPHAPIXELS = 0x1;
+constexpr uint32 DDPF_FOURCC = 0x4;
+constexpr uint32 DDPF_RGB = 0x40;
+constexpr uint32 DDSCAPS2_CUBEMAP = 0x200;
+constexpr uint32 DDSCAPS2_VOLUME = 0x200000;
+constexpr uint32 DDS_DIMENSION_TEXTURE2D = 3;
+constexpr uint32 DDS_MISC_TEXTURECUBE = 0x4;
+constexpr uint32 DDS_FORMAT_R8G8B8A8_UNORM = 28;
+constexpr uint32 DDS_FORMAT_R8G8B8A8_UNORM_SRGB = 29;
+constexpr uint32 DDS_FORMAT_BC1_UNORM = 71;
+constexpr uint32 DDS_FORMAT_BC1_UNORM_SRGB = 72;
+constexpr uint32 DDS_FORMAT_BC2_UNORM = 74;
+constexpr uint32 DDS_FORMAT_BC2_UNORM_SRGB = 75;
+constexpr uint32 DDS_FORMAT_BC3_UNORM = 77;
+constexpr uint32 DDS_FORMAT_BC3_UNORM_SRGB = 78;
+constexpr uint32 DDS_FORMAT_BC4_UNORM = 80;
+constexpr uint32 DDS_FORMAT_BC5_UNORM = 83;
+constexpr uint32 DDS_FORMAT_B8G8R8A8_UNORM = 87;
+constexpr uint32 DDS_FORMAT_B8G8R8A8_UNORM_SRGB = 91;
+constexpr uint32 DDS_FORMAT_BC7_UNORM = 98;
+constexpr uint32 DDS_FORMAT_BC7_UNORM_SRGB = 99;
+
+static constexpr uint32 MakeFourCC(char a, char b, char c, char d) noexcept
+{
+	return static_cast<uint32>(static_cast<uint8>(a)) | (static_cast<uint32>(static_cast<uint8>(b)) << 8) |
+		(static_cast<uint32>(static_cast<uint8>(c)) << 16) | (static_cast<uint32>(static_cast<uint8>(d)) << 24);
+}
+
+static bool ToBlockFormat(uint32 dxgiFormat, BlockFormat& format, bool& isBgra) noexcept
+{
+	isBgra = false;
+
+	switch (dxgiFormat)
+	{
+	case DDS_FORMAT_R8G8B8A8_UNORM:
+	case DDS_FORMAT_R8G8B8A8_UNORM_SRGB:
+		format = BlockFormat::None;
+		return true;
+	case DDS_FORMAT_B8G8R8A8_UNORM:
+	case DDS_FORMAT_B8G8R8A8_UNORM_SRGB:
+		format = BlockFormat::None;
+		isBgra = true;
+		return true;
+	case DDS_FORMAT_BC1_UNORM:
+	case DDS_FORMAT_BC1_UNORM_SRGB:
+		format = BlockFormat::BC1;
+		return true;
+	case DDS_FORMAT_BC2_UNORM:
+	case DDS_FORMAT_BC2_UNORM_SRGB:
+		format = BlockFormat::BC2;
+		return true;
+	case DDS_FORMAT_BC3_UNORM:
+	case DDS_FORMAT_BC3_UNORM_SRGB:
+		format = BlockFormat::BC3;
+		return true;
+	case DDS_FORMAT_BC4_UNORM:
+		format = BlockFormat::BC4;
+		return true;
+	case DDS_FORMAT_BC5_UNORM:
+		format = BlockFormat::BC5;
+		return true;
+	case DDS_FORMAT_BC7_UNORM:
+	case DDS_FORMAT_BC7_UNORM_SRGB:
+		format = BlockFormat::BC7;
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool ToBlockFormat(const DdsPixelFormat& pixelFormat, BlockFormat& format, bool& isBgra) noexcept
+{
+	isBgra = false;
+
+	if (pixelFormat._flags & DDPF_FOURCC)
+	{
+		switch (pixelFormat._fourCC)
+		{
+		case MakeFourCC('D', 'X', 'T', '1'):
+			format = BlockFormat::BC1;
+			return true;
+		case MakeFourCC('D', 'X', 'T', '2'):
+		case MakeFourCC('D', 'X', 'T', '3'):
+			format = BlockFormat::BC2;
+			return true;
+		case MakeFourCC('D', 'X', 'T', '4'):
+		case MakeFourCC('D', 'X', 'T', '5'):
+			format = BlockFormat::BC3;
+			return true;
+		case MakeFourCC('A', 'T', 'I', '1'):
+		case MakeFourCC('B', 'C', '4', 'U'):
+			format = BlockFormat::BC4;
+			return true;
+		case MakeFourCC('A', 'T', 'I', '2'):
+		case MakeFourCC('B', 'C', '5', 'U'):
+			format = BlockFormat::BC5;
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	if ((pixelFormat._flags & DDPF_RGB) && pixelFormat._rgbBitCount == 32 &&
+		(pixelFormat._flags & DDPF_ALPHAPIXELS) && pixelFormat._alphaMask == 0xFF000000)
+	{
+		format = BlockFormat::None;
+
+		if (pixelFormat._redMask == 0x000000FF && pixelFormat._greenMask == 0x0000FF00 && pixelFormat._blueMask == 0x00FF0000)
+		{
+			return true;
+		}
+
+		if (pixelFormat._redMask == 0x00FF0000 && pixelFormat._greenMask == 0x0000FF00 && pixelFormat._blueMask == 0x000000FF)
+		{
+			isBgra = true;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool DdsFile::IsDds(const void* data, size_t dataSize) noexcept
+{
+	uint32 magic = 0;
+
+	if (dataSize < sizeof(magic))
+	{
+		return false;
+	}
+
+	memcpy(&magic, data, sizeof(magic));
+
+	return magic == MAGIC;
+}
+
+bool DdsFile::Parse(const void* data, size_t dataSize, DdsImage& image) noexcept
+{
+	const uint8* bytes = static_cast<const uint8*>(data);
+
+	if (!IsDds(data, dataSize) || dataSize < sizeof(uint32) + sizeof(DdsHeader))
+	{
+		return false;
+	}
+
+	DdsHeader header;
+	memcpy(&header, bytes + sizeof(uint32), sizeof(header));
+
+	if (header._size != HEADER_SIZE || header._pixelFormat._size != PIXEL_FORMAT_SIZE ||
+		header._width == 0 || header._height == 0 || (header._caps2 & (DDSCAPS2_CUBEMAP | DDSCAPS2_VOLUME)))
+	{
+		return false;
+	}
+
+	size_t offset = sizeof(uint32) + sizeof(DdsHeader);
+
+	if ((header._pixelFormat._flags & DDPF_FOURCC) && header._pixelFormat._fourCC == MakeFourCC('D', 'X', '1', '0'))
+	{
+		if (dataSize < offset + sizeof(DdsHeaderDx10))
+		{
+			return false;
+		}
+
+		DdsHeaderDx10 headerDx10;
+		memcpy(&headerDx10, bytes + offset, sizeof(headerDx10));
+		offset += sizeof(DdsHeaderDx10);
+
+		if (headerDx10._resourceDimension != DDS_DIMENSION_TEXTURE2D || headerDx10._arraySize > 1 ||
+			(headerDx10._miscFlag & DDS_MISC_TEXTURECUBE) ||
+			!ToBlockFormat(headerDx10._dxgiFormat, image._format, image._isBgra))
+		{
+			return false;
+		}
+	}
+	else if (!ToBlockFormat(header._pixelFormat, image._format, image._isBgra))
+	{
+		return false;
+	}
+
+	uint32 maxMipLevels = 1;
+
+	for (uint32 size = MAX(header._width, header._height); size > 1; size >>= 1)
+	{
+		++maxMipLevels;
+	}
+
+	const uint32 mipLevels = MAX(1u, header._mipMapCount);
+
+	if (mipLevels > maxMipLevels)
+	{
+		return false;
+	}
+
+	size_t levelsSize = 0;
+
+	for (uint32 level = 0; level < mipLevels; ++level)
+	{
+		levelsSize += GetLevelSize(image._format, MAX(1u, header._width >> level), MAX(1u, header._height >> level));
+	}
+
+	if (dataSize - offset < levelsSize)
+	{
+		return false;
+	}
+
+	if (image._format != BlockFormat::None && (header._width % 4 != 0 || header._height % 4 != 0))
+	{
+		return false;
+	}
+
+	image._data = bytes + offset;
+	image._dataSize = levelsSize;
+	image._width = header._width;
+	image._height = header._height;
+	image._mipLevels = mipLevels;
+
+	return true;
+}
+
+size_t DdsFile::GetLevelSize(BlockFormat format, uint32 width, uint32 height) noexcept
+{
+	if (format == BlockFormat::None)
+	{
+		return static_cast<size_t>(width) * height * 4;
+	}
+
+	return TextureCompressor::GetLevelSize(format, width, height);
+}
@@ -1,22 +1,34 @@
 ﻿#include "Engine.h"
-#include "Window.h"
-#include "GraphicDevice.h"
+#include "Win32Window.h"
+#include "HeadlessWindow.h"
+#include "D3D11GraphicDevice.h"
+#include "NullGraphicDevice.h"
+#include "NullRenderSubmitter.h"
+#include "ThreadPool.h"
+#include "FileIO.h"
 #include "TextureManager.h"
 #include "Renderer.h"
+#include "RenderThread.h"
 #include "Scene.h"
 
 Engine::Engine() noexcept
-	: _window(std::make_unique<Window>())
-	, _graphicDevice(std::make_unique<GraphicDevice>())
+	: _window(nullptr)
+	, _graphicDevice(nullptr)
+	, _threadPool(std::make_unique<ThreadPool>())
+	, _fileIO(std::make_unique<FileIO>(_threadPool.get()))
 	, _textureManager(std::make_unique<TextureManager>())
 	, _renderer(std::make_unique<Renderer>())
+	, _renderThread(std::make_unique<RenderThread>())
+	, _renderSubmitter(nullptr)
 	, _currentScene(nullptr)
 	, _deltaTime(0.0f)
+	, _isHeadless(false)
 {
 }
 
 Engine::~Engine() noexcept
 {
+	_renderThread.reset();
 	_window.reset();
 	_graphicDevice.reset();
 }
@@ -33,12 +45,23 @@ Engine* Engine::GetInstance() noexcept
 	return instance;
 }
 
-void Engine::Init() noexcept
+void Engine::Init([[maybe_unused]] bool isHeadless) noexcept
 {
-	_window->Init();
-	_graphicDevice->Init(_window->GetHWnd());
-	_textureManager->Init(GetDevice()->GetD11Device());
-	_renderer->Init(GetDevice()->GetD11Device(), GetDevice()->GetContext());
+#ifdef _WIN32
+	_isHeadless = isHeadless;
+#else
+	_isHeadless = true;
+#endif
+
+	if (_isHeadless)
+	{
+		InitHeadless();
+	}
+	else
+	{
+		InitD3D11();
+	}
+
 	_currentScene = std::unique_ptr<Scene>(Scene::Create());
 
 	_lastFrameTime = std::chrono::steady_clock::now();
@@ -49,6 +72,7 @@ void Engine::PreUpdate() noexcept
 {
 	CalculateDeltaTime();
 
+	_textureManager->Update();
 	_currentScene->PreUpdate(_deltaTime);
 }
 
@@ -59,16 +83,20 @@ void Engine::Update() noexcept
 
 void Engine::PostUpdate() noexcept
 {
-	_graphicDevice->BeginFrame();
+	_textureManager->LoadPending();
+	_renderer->Begin(_renderThread->GetWriteSnapshot());
 
 	_currentScene->PostUpdate(_deltaTime);
 
-	_graphicDevice->EndFrame();
+	_renderer->End();
+	_renderThread->Publish();
 }
 
 void Engine::Clear() noexcept
 {
+	_renderThread->Stop();
 	_graphicDevice->Clear();
+	_renderer->InvalidateState();
 }
 
 void Engine::SetCurrentScene(Scene* scene) noexcept
@@ -83,11 +111,70 @@ void Engine::ChangeScene(Scene* scene) noexcept
 {
 	assert(scene != nullptr);
 
+	_renderThread->WaitIdle();
 	_currentScene->Clear();
 	_currentScene.reset(scene);
 	_currentScene->Init();
 }
 
+void Engine::SetRenderThreadEnabled(bool isRenderThreadEnabled) noexcept
+{
+	if (isRenderThreadEnabled)
+	{
+		_renderThread->Start();
+	}
+	else
+	{
+		_renderThread->Stop();
+	}
+}
+
+void Engine::SetRenderSubmitter(std::unique_ptr<RenderSubmitter> renderSubmitter) noexcept
+{
+	const bool isRenderThreadRunning = _renderThread->IsRunning();
+	_renderThread->Stop();
+
+	_renderSubmitter = std::move(renderSubmitter);
+
+	if (_renderSubmitter == nullptr && _isHeadless)
+	{
+		_renderSubmitter = std::make_unique<NullRenderSubmitter>();
+	}
+
+	_renderThread->SetSubmitter(_renderSubmitter != nullptr ? _renderSubmitter.get() : _renderer.get());
+
+	if (isRenderThreadRunning)
+	{
+		_renderThread->Start();
+	}
+}
+
+void Engine::InitD3D11() noexcept
+{
+#ifdef _WIN32
+	_window = std::make_unique<Win32Window>();
+	_window->Init();
+	_graphicDevice = std::make_unique<D3D11GraphicDevice>();
+	_graphicDevice->Init(_window.get());
+
+	_textureManager->Init(_graphicDevice->GetContext());
+	_renderer->Init(_graphicDevice->GetContext());
+	SetRenderSubmitter(nullptr);
+#endif
+}
+
+void Engine::InitHeadless() noexcept
+{
+	_window = std::make_unique<HeadlessWindow>();
+	_window->Init();
+	_graphicDevice = std::make_unique<NullGraphicDevice>();
+	_graphicDevice->Init(_window.get());
+
+	_textureManager->Init(_graphicDevice->GetContext());
+	_renderer->Init(_graphicDevice->GetContext());
+	SetRenderSubmitter(nullptr);
+}
+
 void Engine::CalculateDeltaTime() noexcept
 {
 	_currentFrameTime = std::chrono::steady_clock::now();
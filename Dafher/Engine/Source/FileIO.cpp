@@ -0,0 +1,685 @@
+#include "FileIO.h"
+#include "ThreadPool.h"
+
+#ifdef __linux__
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <linux/io_uring.h>
+
+struct UringQueue
+{
+	int32 _descriptor;
+	uint8* _sqRing;
+	size_t _sqRingSize;
+	uint8* _cqRing;
+	size_t _cqRingSize;
+	io_uring_sqe* _sqes;
+	size_t _sqesSize;
+	uint32* _sqTail;
+	uint32* _sqMask;
+	uint32* _sqArray;
+	uint32* _cqHead;
+	uint32* _cqTail;
+	uint32* _cqMask;
+	io_uring_cqe* _cqes;
+};
+
+static inline void DestroyUring(UringQueue& uring) noexcept
+{
+	if (uring._sqes != nullptr)
+	{
+		munmap(uring._sqes, uring._sqesSize);
+	}
+
+	if (uring._cqRing != nullptr && uring._cqRing != uring._sqRing)
+	{
+		munmap(uring._cqRing, uring._cqRingSize);
+	}
+
+	if (uring._sqRing != nullptr)
+	{
+		munmap(uring._sqRing, uring._sqRingSize);
+	}
+
+	close(uring._descriptor);
+}
+
+static inline std::unique_ptr<UringQueue> CreateUring(uint32 entries) noexcept
+{
+	io_uring_params params = {};
+	const int32 descriptor = static_cast<int32>(syscall(__NR_io_uring_setup, entries, &params));
+
+	if (descriptor < 0)
+	{
+		return nullptr;
+	}
+
+	auto uring = std::make_unique<UringQueue>();
+	*uring = UringQueue{};
+	uring->_descriptor = descriptor;
+	uring->_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32);
+	uring->_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+	uring->_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+
+	const bool isSingleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+
+	if (isSingleMap)
+	{
+		uring->_sqRingSize = MAX(uring->_sqRingSize, uring->_cqRingSize);
+	}
+
+	void* sqRing = mmap(nullptr, uring->_sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+		descriptor, IORING_OFF_SQ_RING);
+	void* cqRing = isSingleMap ? sqRing : mmap(nullptr, uring->_cqRingSize, PROT_READ | PROT_WRITE,
+		MAP_SHARED | MAP_POPULATE, descriptor, IORING_OFF_CQ_RING);
+	void* sqes = mmap(nullptr, uring->_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+		descriptor, IORING_OFF_SQES);
+
+	uring->_sqRing = sqRing != MAP_FAILED ? static_cast<uint8*>(sqRing) : nullptr;
+	uring->_cqRing = cqRing != MAP_FAILED ? static_cast<uint8*>(cqRing) : nullptr;
+	uring->_sqes = sqes != MAP_FAILED ? static_cast<io_uring_sqe*>(sqes) : nullptr;
+
+	if (uring->_sqRing == nullptr || uring->_cqRing == nullptr || uring->_sqes == nullptr)
+	{
+		DestroyUring(*uring);
+		return nullptr;
+	}
+
+	uring->_sqTail = reinterpret_cast<uint32*>(uring->_sqRing + params.sq_off.tail);
+	uring->_sqMask = reinterpret_cast<uint32*>(uring->_sqRing + params.sq_off.ring_mask);
+	uring->_sqArray = reinterpret_cast<uint32*>(uring->_sqRing + params.sq_off.array);
+	uring->_cqHead = reinterpret_cast<uint32*>(uring->_cqRing + params.cq_off.head);
+	uring->_cqTail = reinterpret_cast<uint32*>(uring->_cqRing + params.cq_off.tail);
+	uring->_cqMask = reinterpret_cast<uint32*>(uring->_cqRing + params.cq_off.ring_mask);
+	uring->_cqes = reinterpret_cast<io_uring_cqe*>(uring->_cqRing + params.cq_off.cqes);
+
+	return uring;
+}
+
+static inline void PushUringEntry(UringQueue& uring, const io_uring_sqe& entry) noexcept
+{
+	const uint32 tail = *uring._sqTail;
+	const uint32 index = tail & *uring._sqMask;
+
+	uring._sqes[index] = entry;
+	uring._sqArray[index] = index;
+	__atomic_store_n(uring._sqTail, tail + 1, __ATOMIC_RELEASE);
+}
+
+static inline void EnterUring(UringQueue& uring, uint32 submitCount, uint32 waitCount) noexcept
+{
+	while (true)
+	{
+		const int32 result = static_cast<int32>(syscall(__NR_io_uring_enter, uring._descriptor, submitCount, waitCount,
+			waitCount > 0 ? IORING_ENTER_GETEVENTS : 0, nullptr, 0));
+
+		if (result >= 0)
+		{
+			if (static_cast<uint32>(result) >= submitCount)
+			{
+				return;
+			}
+
+			submitCount -= static_cast<uint32>(result);
+			continue;
+		}
+
+		if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+		{
+			assert(false);
+			return;
+		}
+	}
+}
+#else
+struct UringQueue
+{
+};
+#endif
+
+bool IoBuffer::Load(const std::filesystem::path& filePath, IoMode mode) noexcept
+{
+	if (mode == IoMode::Auto)
+	{
+		std::error_code errorCode;
+		const uint64 fileSize = std::filesystem::file_size(filePath, errorCode);
+
+		mode = !errorCode && fileSize >= MAP_THRESHOLD ? IoMode::Map : IoMode::Read;
+	}
+
+	return mode == IoMode::Map ? Map(filePath) : Read(filePath);
+}
+
+bool IoBuffer::Map(const std::filesystem::path& filePath) noexcept
+{
+	Reset();
+
+	auto mappedFile = std::make_unique<MappedFile>();
+
+	if (!mappedFile->Open(filePath))
+	{
+		return false;
+	}
+
+	_size = mappedFile->GetSize();
+	_mappedFile = std::move(mappedFile);
+
+	return true;
+}
+
+bool IoBuffer::Read(const std::filesystem::path& filePath) noexcept
+{
+	Reset();
+
+	std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	const std::streamsize fileSize = file.tellg();
+	file.seekg(0, std::ios::beg);
+
+	if (fileSize <= 0 || !file.read(reinterpret_cast<char*>(Allocate(static_cast<uint64>(fileSize))), fileSize))
+	{
+		Reset();
+		return false;
+	}
+
+	return true;
+}
+
+uint8* IoBuffer::Allocate(uint64 size) noexcept
+{
+	Reset();
+
+	_data.resize(static_cast<size_t>(size));
+	_size = size;
+
+	return _data.data();
+}
+
+void IoBuffer::Reset() noexcept
+{
+	std::vector<uint8>().swap(_data);
+	_mappedFile.reset();
+	_size = 0;
+}
+
+FileIO::FileIO(ThreadPool* threadPool, bool isUringEnabled) noexcept
+	: _threadPool(threadPool)
+	, _nextRequestId(1)
+	, _latencySampleCount(0)
+	, _queuedCount(0)
+	, _inFlightCount(0)
+	, _finishingCount(0)
+	, _maxInFlight(0)
+	, _stats()
+{
+	assert(_threadPool != nullptr);
+
+#ifdef __linux__
+	if (isUringEnabled)
+	{
+		_uring = CreateUring(URING_QUEUE_DEPTH);
+	}
+#endif
+
+	if (_uring != nullptr)
+	{
+		_maxInFlight = URING_QUEUE_DEPTH;
+		_reaperThread = std::thread([this]() { ReapUring(); });
+	}
+	else
+	{
+		_maxInFlight = MAX(1u, _threadPool->GetThreadCount());
+	}
+}
+
+FileIO::~FileIO() noexcept
+{
+	CancelAll();
+	Wait();
+
+#ifdef __linux__
+	if (_uring != nullptr)
+	{
+		{
+			std::lock_guard<std::mutex> lock(_submitMutex);
+
+			io_uring_sqe entry = {};
+			entry.opcode = IORING_OP_NOP;
+			entry.user_data = 0;
+
+			PushUringEntry(*_uring, entry);
+			EnterUring(*_uring, 1, 0);
+		}
+
+		_reaperThread.join();
+		DestroyUring(*_uring);
+	}
+#endif
+}
+
+uint64 FileIO::Submit(IoRequest&& request) noexcept
+{
+	uint64 requestId;
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		requestId = Enqueue(std::move(request));
+	}
+
+	Dispatch();
+
+	return requestId;
+}
+
+void FileIO::SubmitBatch(std::vector<IoRequest>& requests, std::vector<uint64>* requestIds) noexcept
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		for (IoRequest& request : requests)
+		{
+			const uint64 requestId = Enqueue(std::move(request));
+
+			if (requestIds != nullptr)
+			{
+				requestIds->push_back(requestId);
+			}
+		}
+
+		_stats._batchCount++;
+	}
+
+	requests.clear();
+	Dispatch();
+}
+
+bool FileIO::SetPriority(uint64 requestId, IoPriority priority) noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	auto it = _requests.find(requestId);
+
+	if (it == _requests.end() || it->second->_isStarted || it->second->_isCancelled)
+	{
+		return false;
+	}
+
+	IoRequest& request = it->second->_request;
+
+	if (request._priority != priority)
+	{
+		std::deque<uint64>& queue = _queues[static_cast<size_t>(request._priority)];
+		queue.erase(std::find(queue.begin(), queue.end(), requestId));
+
+		request._priority = priority;
+		_queues[static_cast<size_t>(priority)].push_back(requestId);
+	}
+
+	return true;
+}
+
+bool FileIO::Cancel(uint64 requestId) noexcept
+{
+	ActiveRequest* active = nullptr;
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		auto it = _requests.find(requestId);
+
+		if (it == _requests.end() || it->second->_isCancelled)
+		{
+			return false;
+		}
+
+		active = it->second.get();
+		active->_isCancelled = true;
+
+		if (active->_isStarted)
+		{
+			return true;
+		}
+
+		std::deque<uint64>& queue = _queues[static_cast<size_t>(active->_request._priority)];
+		queue.erase(std::find(queue.begin(), queue.end(), requestId));
+		_queuedCount--;
+	}
+
+	_threadPool->Enqueue([this, active]() { Finish(active, IoStatus::Cancelled); });
+
+	return true;
+}
+
+void FileIO::CancelAll() noexcept
+{
+	std::vector<ActiveRequest*> cancelled;
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		for (std::deque<uint64>& queue : _queues)
+		{
+			for (uint64 requestId : queue)
+			{
+				cancelled.push_back(_requests[requestId].get());
+			}
+
+			queue.clear();
+		}
+
+		for (auto& [requestId, active] : _requests)
+		{
+			active->_isCancelled = true;
+		}
+
+		_queuedCount = 0;
+	}
+
+	for (ActiveRequest* active : cancelled)
+	{
+		_threadPool->Enqueue([this, active]() { Finish(active, IoStatus::Cancelled); });
+	}
+}
+
+void FileIO::Wait() noexcept
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	_idleCondition.wait(lock, [this]() { return _requests.empty() && _finishingCount == 0; });
+}
+
+IoStats FileIO::GetStats() const noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	IoStats stats = _stats;
+	stats._queueDepth = _queuedCount;
+	stats._inFlightCount = _inFlightCount;
+	stats._isUringEnabled = _uring != nullptr;
+
+	return stats;
+}
+
+uint64 FileIO::Enqueue(IoRequest&& request) noexcept
+{
+	const uint64 requestId = _nextRequestId++;
+	const IoPriority priority = request._priority;
+
+	auto active = std::make_unique<ActiveRequest>();
+	active->_request = std::move(request);
+	active->_submitTime = std::chrono::steady_clock::now();
+	active->_id = requestId;
+	active->_offset = 0;
+	active->_descriptor = -1;
+	active->_isStarted = false;
+	active->_isCancelled = false;
+
+	_requests.emplace(requestId, std::move(active));
+	_queues[static_cast<size_t>(priority)].push_back(requestId);
+	_queuedCount++;
+
+	return requestId;
+}
+
+void FileIO::Dispatch() noexcept
+{
+	std::vector<ActiveRequest*> started;
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		for (std::deque<uint64>& queue : _queues)
+		{
+			while (!queue.empty() && _inFlightCount < _maxInFlight)
+			{
+				ActiveRequest* active = _requests[queue.front()].get();
+				queue.pop_front();
+
+				active->_isStarted = true;
+				_queuedCount--;
+				_inFlightCount++;
+				started.push_back(active);
+			}
+		}
+	}
+
+	if (started.empty())
+	{
+		return;
+	}
+
+	std::vector<ActiveRequest*> uringReads;
+
+	for (ActiveRequest* active : started)
+	{
+		if (_uring != nullptr && StartUringRead(active))
+		{
+			uringReads.push_back(active);
+		}
+		else
+		{
+			_threadPool->Enqueue([this, active]() { Execute(active); });
+		}
+	}
+
+#ifdef __linux__
+	if (!uringReads.empty())
+	{
+		std::lock_guard<std::mutex> lock(_submitMutex);
+
+		for (ActiveRequest* active : uringReads)
+		{
+			SubmitUringRead(active);
+		}
+
+		EnterUring(*_uring, static_cast<uint32>(uringReads.size()), 0);
+	}
+#endif
+}
+
+void FileIO::Execute(ActiveRequest* active) noexcept
+{
+	bool isCancelled;
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		isCancelled = active->_isCancelled;
+	}
+
+	if (isCancelled)
+	{
+		Finish(active, IoStatus::Cancelled);
+		return;
+	}
+
+	const bool isLoaded = active->_buffer.Load(active->_request._filePath, active->_request._mode);
+
+	Finish(active, isLoaded ? IoStatus::Completed : IoStatus::Failed);
+}
+
+void FileIO::Finish(ActiveRequest* active, IoStatus status) noexcept
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		if (active->_isCancelled)
+		{
+			status = IoStatus::Cancelled;
+		}
+
+		_finishingCount++;
+	}
+
+	if (status != IoStatus::Completed)
+	{
+		active->_buffer.Reset();
+	}
+
+	const uint64 size = active->_buffer.GetSize();
+	const bool isMapped = active->_buffer.IsMapped();
+
+	if (active->_request._callback != nullptr)
+	{
+		active->_request._callback(status, active->_buffer);
+	}
+
+	std::chrono::duration<float, std::milli> latency = std::chrono::steady_clock::now() - active->_submitTime;
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		switch (status)
+		{
+		case IoStatus::Completed:
+			_stats._completedCount++;
+			(isMapped ? _stats._mappedBytes : _stats._readBytes) += size;
+			_latencySampleCount++;
+			_stats._averageLatency += (latency.count() - _stats._averageLatency) / static_cast<float>(_latencySampleCount);
+			_stats._maxLatency = MAX(_stats._maxLatency, latency.count());
+			break;
+		case IoStatus::Failed:
+			_stats._failedCount++;
+			break;
+		default:
+			_stats._cancelledCount++;
+			break;
+		}
+
+		if (active->_isStarted)
+		{
+			_inFlightCount--;
+		}
+
+		_requests.erase(active->_id);
+	}
+
+	Dispatch();
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	if (--_finishingCount == 0 && _requests.empty())
+	{
+		_idleCondition.notify_all();
+	}
+}
+
+#ifdef __linux__
+bool FileIO::StartUringRead(ActiveRequest* active) noexcept
+{
+	if (active->_request._mode == IoMode::Map)
+	{
+		return false;
+	}
+
+	const int32 descriptor = open(active->_request._filePath.c_str(), O_RDONLY | O_CLOEXEC);
+
+	if (descriptor < 0)
+	{
+		return false;
+	}
+
+	struct stat fileStat;
+
+	if (fstat(descriptor, &fileStat) != 0 || fileStat.st_size <= 0 ||
+		(active->_request._mode == IoMode::Auto && static_cast<uint64>(fileStat.st_size) >= IoBuffer::MAP_THRESHOLD))
+	{
+		close(descriptor);
+		return false;
+	}
+
+	active->_buffer.Allocate(static_cast<uint64>(fileStat.st_size));
+	active->_descriptor = descriptor;
+	active->_offset = 0;
+
+	return true;
+}
+
+void FileIO::SubmitUringRead(ActiveRequest* active) noexcept
+{
+	io_uring_sqe entry = {};
+	entry.opcode = IORING_OP_READ;
+	entry.fd = active->_descriptor;
+	entry.addr = reinterpret_cast<uint64>(active->_buffer.GetData() + active->_offset);
+	entry.len = static_cast<uint32>(MIN(active->_buffer.GetSize() - active->_offset, static_cast<uint64>(INT32_MAX)));
+	entry.off = active->_offset;
+	entry.user_data = reinterpret_cast<uint64>(active);
+
+	PushUringEntry(*_uring, entry);
+}
+
+void FileIO::ReapUring() noexcept
+{
+	bool isStopping = false;
+
+	while (!isStopping)
+	{
+		EnterUring(*_uring, 0, 1);
+
+		uint32 head = *_uring->_cqHead;
+		const uint32 tail = __atomic_load_n(_uring->_cqTail, __ATOMIC_ACQUIRE);
+
+		for (; head != tail; ++head)
+		{
+			const io_uring_cqe& completion = _uring->_cqes[head & *_uring->_cqMask];
+			ActiveRequest* active = reinterpret_cast<ActiveRequest*>(completion.user_data);
+
+			if (active == nullptr)
+			{
+				isStopping = true;
+				continue;
+			}
+
+			if (completion.res > 0)
+			{
+				active->_offset += static_cast<uint64>(completion.res);
+
+				if (active->_offset < active->_buffer.GetSize())
+				{
+					std::lock_guard<std::mutex> lock(_submitMutex);
+
+					SubmitUringRead(active);
+					EnterUring(*_uring, 1, 0);
+					continue;
+				}
+			}
+
+			close(active->_descriptor);
+			active->_descriptor = -1;
+
+			if (completion.res < 0)
+			{
+				_threadPool->Enqueue([this, active]() { Execute(active); });
+			}
+			else
+			{
+				const IoStatus status = completion.res > 0 ? IoStatus::Completed : IoStatus::Failed;
+				_threadPool->Enqueue([this, active, status]() { Finish(active, status); });
+			}
+		}
+
+		__atomic_store_n(_uring->_cqHead, head, __ATOMIC_RELEASE);
+	}
+}
+#else
+bool FileIO::StartUringRead(ActiveRequest* active) noexcept
+{
+	return false;
+}
+
+void FileIO::SubmitUringRead(ActiveRequest* active) noexcept
+{
+}
+
+void FileIO::ReapUring() noexcept
+{
+}
+#endif
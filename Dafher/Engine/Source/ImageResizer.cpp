@@ -0,0 +1,49 @@
+#include "ImageResizer.h"
+#include "ThreadPool.h"
+
+#include "stb_image_resize2.h"
+
+bool ImageResizer::Resize(const uint8* inputData, uint32 inputWidth, uint32 inputHeight,
+	uint8* outputData, uint32 outputWidth, uint32 outputHeight, ThreadPool* threadPool) noexcept
+{
+	assert(inputData != nullptr && outputData != nullptr);
+
+	const uint64 outputPixels = static_cast<uint64>(outputWidth) * outputHeight;
+
+	if (threadPool == nullptr || threadPool->GetThreadCount() == 0 || outputPixels < MIN_SPLIT_PIXELS)
+	{
+		return stbir_resize_uint8_linear(
+			inputData, inputWidth, inputHeight, 0,
+			outputData, outputWidth, outputHeight, 0,
+			STBIR_RGBA
+		) != nullptr;
+	}
+
+	STBIR_RESIZE resize;
+	stbir_resize_init(&resize,
+		inputData, inputWidth, inputHeight, 0,
+		outputData, outputWidth, outputHeight, 0,
+		STBIR_RGBA, STBIR_TYPE_UINT8);
+
+	const int splitCount = stbir_build_samplers_with_splits(&resize, static_cast<int>(threadPool->GetThreadCount() + 1));
+
+	if (splitCount == 0)
+	{
+		return false;
+	}
+
+	std::atomic<bool> isResized(true);
+
+	threadPool->ParallelFor(static_cast<uint32>(splitCount),
+		[&resize, &isResized](uint32 index)
+		{
+			if (!stbir_resize_extended_split(&resize, static_cast<int>(index), 1))
+			{
+				isResized = false;
+			}
+		});
+
+	stbir_free_samplers(&resize);
+
+	return isResized;
+}
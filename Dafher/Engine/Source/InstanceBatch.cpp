@@ -0,0 +1,95 @@
+#include "InstanceBatch.h"
+
+InstanceBatch::InstanceBatch(uint32 maxInstances) noexcept
+	: _backend(nullptr)
+	, _maxInstances(maxInstances)
+	, _instanceCount(0)
+	, _isBegun(false)
+	, _stats()
+{
+	assert(_maxInstances > 0);
+
+	_instances.resize(_maxInstances);
+	_ranges.reserve(64);
+}
+
+void InstanceBatch::Begin() noexcept
+{
+	assert(!_isBegun);
+
+	_isBegun = true;
+	_instanceCount = 0;
+	_ranges.clear();
+}
+
+void InstanceBatch::Submit(Texture* texture, const Matrix& worldMatrix,
+	const Vector4& uvRect, const Color& color, BlendMode blendMode) noexcept
+{
+	InstanceData instance;
+	Pack(instance, worldMatrix, uvRect, color);
+
+	Submit(texture, instance, blendMode);
+}
+
+void InstanceBatch::Submit(Texture* texture, const InstanceData& instance, BlendMode blendMode) noexcept
+{
+	assert(_isBegun);
+
+	if (_instanceCount == _maxInstances)
+	{
+		Flush();
+	}
+
+	if (_ranges.empty() || _ranges.back()._texture != texture || _ranges.back()._blendMode != blendMode)
+	{
+		_ranges.push_back({ texture, _instanceCount, 0, blendMode });
+	}
+
+	_instances[_instanceCount] = instance;
+
+	_ranges.back()._quadCount++;
+	_instanceCount++;
+	_stats._quadCount++;
+}
+
+void InstanceBatch::End() noexcept
+{
+	assert(_isBegun);
+
+	Flush();
+	_isBegun = false;
+}
+
+void InstanceBatch::Pack(InstanceData& instance, const Matrix& worldMatrix,
+	const Vector4& uvRect, const Color& color) noexcept
+{
+	instance._axes = Vector4(worldMatrix._11, worldMatrix._12, worldMatrix._21, worldMatrix._22);
+	instance._translation = Vector4(worldMatrix._41, worldMatrix._42, worldMatrix._43, 0.0f);
+	instance._uvRect = uvRect;
+	instance._color = color;
+}
+
+void InstanceBatch::ResetStats() noexcept
+{
+	_stats = BatchStats();
+}
+
+void InstanceBatch::Flush() noexcept
+{
+	if (_instanceCount == 0)
+	{
+		return;
+	}
+
+	if (_backend != nullptr)
+	{
+		_backend->Flush(_instances.data(), _instanceCount,
+			_ranges.data(), static_cast<uint32>(_ranges.size()));
+	}
+
+	_stats._rangeCount += static_cast<uint32>(_ranges.size());
+	_stats._flushCount++;
+
+	_instanceCount = 0;
+	_ranges.clear();
+}
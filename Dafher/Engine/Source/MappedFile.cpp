@@ -0,0 +1,144 @@
+#include "MappedFile.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile() noexcept
+	: _data(nullptr)
+	, _size(0)
+#ifdef _WIN32
+	, _file(INVALID_HANDLE_VALUE)
+	, _mapping(nullptr)
+#else
+	, _descriptor(-1)
+#endif
+{
+}
+
+MappedFile::~MappedFile() noexcept
+{
+	Close();
+}
+
+#ifdef _WIN32
+
+bool MappedFile::Open(const std::filesystem::path& filePath) noexcept
+{
+	Close();
+
+	_file = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (_file == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER fileSize;
+
+	if (!GetFileSizeEx(_file, &fileSize) || fileSize.QuadPart == 0)
+	{
+		Close();
+		return false;
+	}
+
+	_mapping = CreateFileMappingW(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+	if (_mapping == nullptr)
+	{
+		Close();
+		return false;
+	}
+
+	_data = static_cast<const uint8*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+	_size = static_cast<uint64>(fileSize.QuadPart);
+
+	if (_data == nullptr)
+	{
+		Close();
+		return false;
+	}
+
+	return true;
+}
+
+void MappedFile::Close() noexcept
+{
+	if (_data != nullptr)
+	{
+		UnmapViewOfFile(_data);
+	}
+
+	if (_mapping != nullptr)
+	{
+		CloseHandle(_mapping);
+	}
+
+	if (_file != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(_file);
+	}
+
+	_data = nullptr;
+	_size = 0;
+	_file = INVALID_HANDLE_VALUE;
+	_mapping = nullptr;
+}
+
+#else
+
+bool MappedFile::Open(const std::filesystem::path& filePath) noexcept
+{
+	Close();
+
+	_descriptor = open(filePath.c_str(), O_RDONLY);
+
+	if (_descriptor < 0)
+	{
+		return false;
+	}
+
+	struct stat fileStat;
+
+	if (fstat(_descriptor, &fileStat) != 0 || fileStat.st_size == 0)
+	{
+		Close();
+		return false;
+	}
+
+	void* data = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, _descriptor, 0);
+
+	if (data == MAP_FAILED)
+	{
+		Close();
+		return false;
+	}
+
+	_data = static_cast<const uint8*>(data);
+	_size = static_cast<uint64>(fileStat.st_size);
+
+	return true;
+}
+
+void MappedFile::Close() noexcept
+{
+	if (_data != nullptr)
+	{
+		munmap(const_cast<uint8*>(_data), static_cast<size_t>(_size));
+	}
+
+	if (_descriptor >= 0)
+	{
+		close(_descriptor);
+	}
+
+	_data = nullptr;
+	_size = 0;
+	_descriptor = -1;
+}
+
+#endif
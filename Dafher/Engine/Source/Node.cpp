@@ -1,6 +1,7 @@
 #include "Node.h"
 #include "Engine.h"
 #include "GraphicDevice.h"
+#include "Renderer.h"
 
 bool Node::Init()
 {
@@ -50,10 +51,21 @@ void Node::Update(float delta)
 			child->Update(delta);
 		}
 	}
+
+	UpdateBounds();
 }
 
 void Node::PostUpdate(float delta)
 {
+	Renderer* renderer = Engine::GetInstance()->GetRenderer();
+
+	if (renderer->IsSubtreeCullingEnabled() && _subtreeBounds.IsValid() &&
+		!renderer->IsVisible(_subtreeBounds))
+	{
+		renderer->AddCulledSubtree();
+		return;
+	}
+
 	for (auto& component : _components)
 	{
 		if (component->IsEnabled())
@@ -114,4 +126,29 @@ Node* Node::GetChildByName(const std::string& name) const noexcept
 	}
 
 	return nullptr;
+}
+
+void Node::UpdateBounds() noexcept
+{
+	_bounds = Bounds();
+
+	for (const auto& component : _components)
+	{
+		Bounds componentBounds;
+
+		if (component->IsEnabled() && component->GetWorldBounds(componentBounds))
+		{
+			_bounds.Merge(componentBounds);
+		}
+	}
+
+	_subtreeBounds = _bounds;
+
+	for (const auto& child : _children)
+	{
+		if (child->IsEnabled() && child->_subtreeBounds.IsValid())
+		{
+			_subtreeBounds.Merge(child->_subtreeBounds);
+		}
+	}
 }
\ No newline at end of file
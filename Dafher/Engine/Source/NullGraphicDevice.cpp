@@ -0,0 +1,30 @@
+#include "NullGraphicDevice.h"
+#include "Window.h"
+
+bool NullGraphicDevice::Init(Window* window) noexcept
+{
+	assert(window != nullptr);
+
+	SetSize(window->GetWidth(), window->GetHeight());
+	_frameCount = 0;
+
+	return true;
+}
+
+void NullGraphicDevice::BeginFrame() noexcept
+{
+}
+
+void NullGraphicDevice::EndFrame() noexcept
+{
+	_frameCount++;
+}
+
+void NullGraphicDevice::Clear() noexcept
+{
+}
+
+GraphicContext* NullGraphicDevice::GetContext() const noexcept
+{
+	return nullptr;
+}
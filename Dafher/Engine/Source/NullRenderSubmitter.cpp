@@ -0,0 +1,28 @@
+#include "NullRenderSubmitter.h"
+
+void NullRenderSubmitter::Render(const RenderSnapshot& snapshot) noexcept
+{
+	_frameCount++;
+	_viewCount += snapshot._views.size();
+	_lastFrameIndex = snapshot._frameIndex;
+
+	for (const SnapshotView& view : snapshot._views)
+	{
+		assert(view._firstItem + view._itemCount <= snapshot._visibleItems.size());
+
+		for (uint32 i = 0; i < view._itemCount; ++i)
+		{
+			assert(snapshot._visibleItems[view._firstItem + i] < snapshot._drawItems.size());
+		}
+
+		_itemCount += view._itemCount;
+	}
+}
+
+void NullRenderSubmitter::Reset() noexcept
+{
+	_frameCount = 0;
+	_viewCount = 0;
+	_itemCount = 0;
+	_lastFrameIndex = 0;
+}
@@ -0,0 +1,113 @@
+#include "Platform.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+void Platform::DebugOutput(const std::string& message) noexcept
+{
+#ifdef _WIN32
+	OutputDebugStringA(message.c_str());
+#else
+	std::fputs(message.c_str(), stderr);
+#endif
+}
+
+void Platform::EnumerateFiles(const std::filesystem::path& folderPath,
+	std::vector<std::filesystem::path>& files) noexcept
+{
+	std::error_code errorCode;
+	std::filesystem::recursive_directory_iterator it(folderPath, errorCode);
+
+	assert(!errorCode);
+
+	for (const std::filesystem::recursive_directory_iterator end; it != end; it.increment(errorCode))
+	{
+		if (errorCode)
+		{
+			break;
+		}
+
+		if (it->is_regular_file(errorCode))
+		{
+			files.push_back(it->path());
+		}
+	}
+
+	std::sort(files.begin(), files.end());
+}
+
+std::string Platform::ToUtf8(const std::filesystem::path& path) noexcept
+{
+	return path.u8string();
+}
+
+bool Platform::EvictFileCache(const std::filesystem::path& filePath) noexcept
+{
+#ifdef _WIN32
+	// Opening a file unbuffered drops its pages from the system file cache.
+	HANDLE file = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+		OPEN_EXISTING, FILE_FLAG_NO_BUFFERING, nullptr);
+
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	CloseHandle(file);
+	return true;
+#else
+	const int descriptor = open(filePath.c_str(), O_RDONLY);
+
+	if (descriptor < 0)
+	{
+		return false;
+	}
+
+	// Dirty pages are not dropped, so a file that was just written is flushed first.
+	const bool isEvicted = fdatasync(descriptor) == 0 &&
+		posix_fadvise(descriptor, 0, 0, POSIX_FADV_DONTNEED) == 0;
+	close(descriptor);
+
+	return isEvicted;
+#endif
+}
+
+#ifndef _WIN32
+
+namespace DirectX::SimpleMath
+{
+	const Vector2 Vector2::Zero = { 0.0f, 0.0f };
+	const Vector2 Vector2::One = { 1.0f, 1.0f };
+	const Vector2 Vector2::UnitX = { 1.0f, 0.0f };
+	const Vector2 Vector2::UnitY = { 0.0f, 1.0f };
+
+	const Vector3 Vector3::Zero = { 0.0f, 0.0f, 0.0f };
+	const Vector3 Vector3::One = { 1.0f, 1.0f, 1.0f };
+	const Vector3 Vector3::UnitX = { 1.0f, 0.0f, 0.0f };
+	const Vector3 Vector3::UnitY = { 0.0f, 1.0f, 0.0f };
+	const Vector3 Vector3::UnitZ = { 0.0f, 0.0f, 1.0f };
+	const Vector3 Vector3::Up = { 0.0f, 1.0f, 0.0f };
+	const Vector3 Vector3::Down = { 0.0f, -1.0f, 0.0f };
+	const Vector3 Vector3::Right = { 1.0f, 0.0f, 0.0f };
+	const Vector3 Vector3::Left = { -1.0f, 0.0f, 0.0f };
+	const Vector3 Vector3::Forward = { 0.0f, 0.0f, -1.0f };
+	const Vector3 Vector3::Backward = { 0.0f, 0.0f, 1.0f };
+
+	const Vector4 Vector4::Zero = { 0.0f, 0.0f, 0.0f, 0.0f };
+	const Vector4 Vector4::One = { 1.0f, 1.0f, 1.0f, 1.0f };
+	const Vector4 Vector4::UnitX = { 1.0f, 0.0f, 0.0f, 0.0f };
+	const Vector4 Vector4::UnitY = { 0.0f, 1.0f, 0.0f, 0.0f };
+	const Vector4 Vector4::UnitZ = { 0.0f, 0.0f, 1.0f, 0.0f };
+	const Vector4 Vector4::UnitW = { 0.0f, 0.0f, 0.0f, 1.0f };
+
+	const Matrix Matrix::Identity = { 1.0f, 0.0f, 0.0f, 0.0f,
+		0.0f, 1.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 1.0f, 0.0f,
+		0.0f, 0.0f, 0.0f, 1.0f };
+
+	const Quaternion Quaternion::Identity = { 0.0f, 0.0f, 0.0f, 1.0f };
+}
+
+#endif
@@ -0,0 +1,108 @@
+#include "QuadBatch.h"
+#include "InstanceBatch.h"
+
+QuadBatch::QuadBatch(uint32 maxQuads) noexcept
+	: _backend(nullptr)
+	, _maxQuads(maxQuads)
+	, _quadCount(0)
+	, _isBegun(false)
+	, _stats()
+{
+	assert(_maxQuads > 0);
+
+	_vertices.resize(static_cast<size_t>(_maxQuads) * 4);
+	_ranges.reserve(64);
+}
+
+void QuadBatch::Begin() noexcept
+{
+	assert(!_isBegun);
+
+	_isBegun = true;
+	_quadCount = 0;
+	_ranges.clear();
+}
+
+void QuadBatch::Submit(Texture* texture, const Matrix& worldMatrix,
+	const Vector4& uvRect, const Color& color, BlendMode blendMode) noexcept
+{
+	InstanceData instance;
+	InstanceBatch::Pack(instance, worldMatrix, uvRect, color);
+
+	Submit(texture, instance, blendMode);
+}
+
+void QuadBatch::Submit(Texture* texture, const InstanceData& instance, BlendMode blendMode) noexcept
+{
+	assert(_isBegun);
+
+	if (_quadCount == _maxQuads)
+	{
+		Flush();
+	}
+
+	if (_ranges.empty() || _ranges.back()._texture != texture || _ranges.back()._blendMode != blendMode)
+	{
+		_ranges.push_back({ texture, _quadCount, 0, blendMode });
+	}
+
+	const float originX = instance._translation.x;
+	const float originY = instance._translation.y;
+	const float originZ = instance._translation.z;
+
+	const float axisXX = instance._axes.x;
+	const float axisXY = instance._axes.y;
+	const float axisYX = instance._axes.z;
+	const float axisYY = instance._axes.w;
+
+	const Vector4& uvRect = instance._uvRect;
+	const Color& color = instance._color;
+
+	BatchVertex* vertex = &_vertices[static_cast<size_t>(_quadCount) * 4];
+
+	vertex[0] = { originX + axisYX, originY + axisYY, originZ,
+		uvRect.x, uvRect.y, color.R(), color.G(), color.B(), color.A() };
+	vertex[1] = { originX + axisXX + axisYX, originY + axisXY + axisYY, originZ,
+		uvRect.z, uvRect.y, color.R(), color.G(), color.B(), color.A() };
+	vertex[2] = { originX + axisXX, originY + axisXY, originZ,
+		uvRect.z, uvRect.w, color.R(), color.G(), color.B(), color.A() };
+	vertex[3] = { originX, originY, originZ,
+		uvRect.x, uvRect.w, color.R(), color.G(), color.B(), color.A() };
+
+	_ranges.back()._quadCount++;
+	_quadCount++;
+	_stats._quadCount++;
+}
+
+void QuadBatch::End() noexcept
+{
+	assert(_isBegun);
+
+	Flush();
+	_isBegun = false;
+}
+
+void QuadBatch::ResetStats() noexcept
+{
+	_stats = BatchStats();
+}
+
+void QuadBatch::Flush() noexcept
+{
+	if (_quadCount == 0)
+	{
+		return;
+	}
+
+	if (_backend != nullptr)
+	{
+		_backend->Flush(_vertices.data(), _quadCount,
+			_ranges.data(), static_cast<uint32>(_ranges.size()));
+	}
+
+	_stats._rangeCount += static_cast<uint32>(_ranges.size());
+	_stats._flushCount++;
+
+	_quadCount = 0;
+	_ranges.clear();
+}
@@ -0,0 +1,39 @@
+#include "RecordingBatchBackend.h"
+
+void RecordingBatchBackend::Flush(const BatchVertex* vertices, uint32 quadCount,
+	const BatchRange* ranges, uint32 rangeCount) noexcept
+{
+	const uint32 baseVertex = static_cast<uint32>(_vertices.size());
+	_vertices.insert(_vertices.end(), vertices, vertices + static_cast<size_t>(quadCount) * 4);
+
+	for (uint32 i = 0; i < rangeCount; ++i)
+	{
+		_draws.push_back({ ranges[i]._texture, _flushCount,
+			baseVertex + ranges[i]._firstQuad * 4, ranges[i]._quadCount * 4, ranges[i]._blendMode });
+	}
+
+	_flushCount++;
+}
+
+void RecordingBatchBackend::Flush(const InstanceData* instances, uint32 instanceCount,
+	const BatchRange* ranges, uint32 rangeCount) noexcept
+{
+	const uint32 baseInstance = static_cast<uint32>(_instances.size());
+	_instances.insert(_instances.end(), instances, instances + instanceCount);
+
+	for (uint32 i = 0; i < rangeCount; ++i)
+	{
+		_draws.push_back({ ranges[i]._texture, _flushCount,
+			baseInstance + ranges[i]._firstQuad, ranges[i]._quadCount, ranges[i]._blendMode });
+	}
+
+	_flushCount++;
+}
+
+void RecordingBatchBackend::Reset() noexcept
+{
+	_draws.clear();
+	_vertices.clear();
+	_instances.clear();
+	_flushCount = 0;
+}
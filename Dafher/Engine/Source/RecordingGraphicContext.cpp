@@ -0,0 +1,155 @@
+#include "RecordingGraphicContext.h"
+#include "Texture.h"
+
+bool RecordingGraphicContext::CreateResources([[maybe_unused]] uint32 maxQuads, [[maybe_unused]] uint32 maxInstances) noexcept
+{
+	assert(maxQuads * 4 <= 0x10000);
+	assert(maxInstances > 0);
+
+	_hasResources = true;
+
+	return true;
+}
+
+std::unique_ptr<GraphicTexture> RecordingGraphicContext::CreateTexture([[maybe_unused]] const Texture& texture) noexcept
+{
+	assert(texture.GetWidth() > 0 && texture.GetHeight() > 0);
+
+	_textureCount++;
+
+	return std::make_unique<GraphicTexture>();
+}
+
+void RecordingGraphicContext::SetViewport([[maybe_unused]] const Vector4& viewport) noexcept
+{
+	assert(viewport.z >= 0.0f && viewport.w >= 0.0f);
+
+	_viewportCount++;
+}
+
+void RecordingGraphicContext::UpdateBuffer(GraphicBuffer buffer, [[maybe_unused]] const void* data, [[maybe_unused]] size_t dataSize) noexcept
+{
+	assert(_hasResources);
+	assert(data != nullptr && dataSize > 0);
+
+	_bufferUpdateCounts[static_cast<size_t>(buffer)]++;
+}
+
+void RecordingGraphicContext::UpdateTexture([[maybe_unused]] Texture* texture, [[maybe_unused]] uint32 x, [[maybe_unused]] uint32 y,
+	[[maybe_unused]] uint32 width, [[maybe_unused]] uint32 height, [[maybe_unused]] const uint8* data) noexcept
+{
+	assert(texture != nullptr && data != nullptr);
+	assert(x + width <= texture->GetWidth() && y + height <= texture->GetHeight());
+
+	_textureUpdateCount++;
+}
+
+void RecordingGraphicContext::SetRasterizerState() noexcept
+{
+	Record(RenderBinding::RasterizerState);
+}
+
+void RecordingGraphicContext::SetBlendState([[maybe_unused]] BlendMode blendMode) noexcept
+{
+	assert(blendMode < BlendMode::Count);
+
+	Record(RenderBinding::BlendState);
+}
+
+void RecordingGraphicContext::SetVertexShader([[maybe_unused]] GraphicShader shader) noexcept
+{
+	assert(shader != GraphicShader::SpritePixel);
+
+	Record(RenderBinding::VertexShader);
+}
+
+void RecordingGraphicContext::SetPixelShader([[maybe_unused]] GraphicShader shader) noexcept
+{
+	assert(shader == GraphicShader::SpritePixel);
+
+	Record(RenderBinding::PixelShader);
+}
+
+void RecordingGraphicContext::SetInputLayout([[maybe_unused]] GraphicInputLayout inputLayout) noexcept
+{
+	assert(inputLayout < GraphicInputLayout::Count);
+
+	Record(RenderBinding::InputLayout);
+}
+
+void RecordingGraphicContext::SetConstantBuffer([[maybe_unused]] GraphicBuffer buffer) noexcept
+{
+	assert(buffer == GraphicBuffer::ViewProjection);
+
+	Record(RenderBinding::ConstantBuffer);
+}
+
+void RecordingGraphicContext::SetSampler() noexcept
+{
+	Record(RenderBinding::Sampler);
+}
+
+void RecordingGraphicContext::SetTopology() noexcept
+{
+	Record(RenderBinding::Topology);
+}
+
+void RecordingGraphicContext::SetVertexBuffer(uint32 slot, GraphicBuffer, [[maybe_unused]] uint32 stride) noexcept
+{
+	assert(slot < 2 && stride > 0);
+
+	Record(slot == 0 ? RenderBinding::VertexBuffer0 : RenderBinding::VertexBuffer1);
+}
+
+void RecordingGraphicContext::SetIndexBuffer([[maybe_unused]] GraphicBuffer buffer) noexcept
+{
+	assert(buffer == GraphicBuffer::QuadIndex || buffer == GraphicBuffer::BatchIndex);
+
+	Record(RenderBinding::IndexBuffer);
+}
+
+void RecordingGraphicContext::SetTexture([[maybe_unused]] const Texture* texture) noexcept
+{
+	assert(texture != nullptr);
+
+	Record(RenderBinding::ShaderResource);
+}
+
+void RecordingGraphicContext::DrawIndexed(uint32 indexCount, uint32) noexcept
+{
+	assert(_hasResources);
+
+	_drawCount++;
+	_indexCount += indexCount;
+}
+
+void RecordingGraphicContext::DrawIndexedInstanced(uint32 indexCount, uint32 instanceCount, uint32) noexcept
+{
+	assert(_hasResources);
+
+	_drawCount++;
+	_indexCount += static_cast<uint64>(indexCount) * instanceCount;
+	_instanceCount += instanceCount;
+}
+
+uint64 RecordingGraphicContext::GetTextureBinding(const Texture* texture) const noexcept
+{
+	return static_cast<uint64>(reinterpret_cast<uintptr_t>(texture));
+}
+
+void RecordingGraphicContext::Reset() noexcept
+{
+	_bindCounts.fill(0);
+	_bufferUpdateCounts.fill(0);
+	_textureCount = 0;
+	_textureUpdateCount = 0;
+	_viewportCount = 0;
+	_drawCount = 0;
+	_indexCount = 0;
+	_instanceCount = 0;
+}
+
+void RecordingGraphicContext::Record(RenderBinding binding) noexcept
+{
+	_bindCounts[static_cast<size_t>(binding)]++;
+}
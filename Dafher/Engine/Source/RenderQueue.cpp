@@ -0,0 +1,88 @@
+#include "RenderQueue.h"
+
+void RenderQueue::Clear() noexcept
+{
+	_entries.clear();
+}
+
+void RenderQueue::Push(uint64 key, uint32 index) noexcept
+{
+	_entries.push_back({ key, index });
+}
+
+void RenderQueue::Sort() noexcept
+{
+	std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+	const size_t count = _entries.size();
+
+	if (count > 1)
+	{
+		_scratch.resize(count);
+
+		std::array<std::array<uint32, RADIX_SIZE>, PASS_COUNT> histograms = {};
+
+		for (const RenderQueueEntry& entry : _entries)
+		{
+			for (uint32 pass = 0; pass < PASS_COUNT; ++pass)
+			{
+				histograms[pass][(entry._key >> (pass * RADIX_BITS)) & (RADIX_SIZE - 1)]++;
+			}
+		}
+
+		RenderQueueEntry* source = _entries.data();
+		RenderQueueEntry* destination = _scratch.data();
+
+		for (uint32 pass = 0; pass < PASS_COUNT; ++pass)
+		{
+			const uint32 shift = pass * RADIX_BITS;
+			std::array<uint32, RADIX_SIZE>& histogram = histograms[pass];
+
+			if (histogram[(source[0]._key >> shift) & (RADIX_SIZE - 1)] == count)
+			{
+				continue;
+			}
+
+			uint32 offset = 0;
+
+			for (uint32& bucket : histogram)
+			{
+				uint32 bucketCount = bucket;
+				bucket = offset;
+				offset += bucketCount;
+			}
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				const uint32 digit = static_cast<uint32>((source[i]._key >> shift) & (RADIX_SIZE - 1));
+				destination[histogram[digit]++] = source[i];
+			}
+
+			std::swap(source, destination);
+		}
+
+		if (source != _entries.data())
+		{
+			_entries.swap(_scratch);
+		}
+	}
+
+	std::chrono::duration<float, std::milli> sortTime = std::chrono::steady_clock::now() - startTime;
+	_lastSortTime = sortTime.count();
+}
+
+uint64 RenderQueue::MakeKey(uint8 layer, BlendMode blendMode, uint32 textureId, float depth) noexcept
+{
+	assert(textureId <= MAX_TEXTURE_ID);
+
+	uint32 depthBits;
+	memcpy(&depthBits, &depth, sizeof(depthBits));
+	depthBits = (depthBits & 0x80000000u) ? ~depthBits : (depthBits | 0x80000000u);
+
+	const uint32 batchId = blendMode == BlendMode::Alpha ? 0 : textureId & MAX_TEXTURE_ID;
+
+	return (static_cast<uint64>(layer) << LAYER_SHIFT) |
+		(static_cast<uint64>(blendMode) << BLEND_MODE_SHIFT) |
+		(static_cast<uint64>(batchId) << TEXTURE_ID_SHIFT) |
+		static_cast<uint64>(depthBits);
+}
@@ -0,0 +1,53 @@
+#include "RenderStateCache.h"
+
+bool RenderStateCache::Bind(RenderBinding binding, uint64 value) noexcept
+{
+	assert(binding != RenderBinding::Count);
+
+	const size_t index = static_cast<size_t>(binding);
+
+	if (_boundValues[index] == value)
+	{
+		_elidedCounts[index]++;
+		return false;
+	}
+
+	_boundValues[index] = value;
+	_issuedCounts[index]++;
+	return true;
+}
+
+void RenderStateCache::Invalidate() noexcept
+{
+	_boundValues.fill(UNBOUND);
+}
+
+void RenderStateCache::ResetCounters() noexcept
+{
+	_issuedCounts.fill(0);
+	_elidedCounts.fill(0);
+}
+
+uint32 RenderStateCache::GetIssuedCount() const noexcept
+{
+	uint32 count = 0;
+
+	for (uint32 issuedCount : _issuedCounts)
+	{
+		count += issuedCount;
+	}
+
+	return count;
+}
+
+uint32 RenderStateCache::GetElidedCount() const noexcept
+{
+	uint32 count = 0;
+
+	for (uint32 elidedCount : _elidedCounts)
+	{
+		count += elidedCount;
+	}
+
+	return count;
+}
@@ -0,0 +1,131 @@
+#include "RenderThread.h"
+
+RenderThread::RenderThread() noexcept
+	: _submitter(nullptr)
+	, _writeIndex(0)
+	, _pendingIndex(0)
+	, _publishedFrameCount(0)
+	, _renderedFrameCount(0)
+	, _lastWaitTime(0.0f)
+	, _hasPending(false)
+	, _isRendering(false)
+	, _isRunning(false)
+	, _isStopping(false)
+{
+	for (RenderSnapshot& snapshot : _snapshots)
+	{
+		snapshot._frameIndex = 0;
+	}
+}
+
+RenderThread::~RenderThread() noexcept
+{
+	Stop();
+}
+
+void RenderThread::Start() noexcept
+{
+	assert(_submitter != nullptr);
+
+	if (_isRunning)
+	{
+		return;
+	}
+
+	_isStopping = false;
+	_isRunning = true;
+	_thread = std::thread(&RenderThread::Run, this);
+}
+
+void RenderThread::Stop() noexcept
+{
+	if (!_isRunning)
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_isStopping = true;
+	}
+
+	_condition.notify_all();
+	_thread.join();
+
+	_isRunning = false;
+}
+
+void RenderThread::Publish() noexcept
+{
+	assert(_submitter != nullptr);
+
+	RenderSnapshot& snapshot = _snapshots[_writeIndex];
+	snapshot._frameIndex = ++_publishedFrameCount;
+
+	if (!_isRunning)
+	{
+		_submitter->Render(snapshot);
+		_renderedFrameCount = snapshot._frameIndex;
+		_lastWaitTime = 0.0f;
+		return;
+	}
+
+	std::chrono::steady_clock::time_point waitStart = std::chrono::steady_clock::now();
+
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		_condition.wait(lock, [this]() { return !_hasPending && !_isRendering; });
+
+		_pendingIndex = _writeIndex;
+		_hasPending = true;
+		_writeIndex = 1 - _writeIndex;
+	}
+
+	std::chrono::duration<float, std::milli> waitTime = std::chrono::steady_clock::now() - waitStart;
+	_lastWaitTime = waitTime.count();
+
+	_condition.notify_all();
+}
+
+void RenderThread::WaitIdle() noexcept
+{
+	if (!_isRunning)
+	{
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock(_mutex);
+	_condition.wait(lock, [this]() { return !_hasPending && !_isRendering; });
+}
+
+void RenderThread::Run() noexcept
+{
+	while (true)
+	{
+		uint32 readIndex = 0;
+
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_condition.wait(lock, [this]() { return _hasPending || _isStopping; });
+
+			if (!_hasPending)
+			{
+				return;
+			}
+
+			readIndex = _pendingIndex;
+			_hasPending = false;
+			_isRendering = true;
+		}
+
+		_submitter->Render(_snapshots[readIndex]);
+
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_renderedFrameCount = _snapshots[readIndex]._frameIndex;
+			_isRendering = false;
+		}
+
+		_condition.notify_all();
+	}
+}
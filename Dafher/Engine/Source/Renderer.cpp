@@ -3,241 +3,372 @@
 #include "Texture.h"
 #include "Engine.h"
 #include "GraphicDevice.h"
+#include "Camera.h"
 
-bool Renderer::Init(const ComPtr<ID3D11Device>& device, const ComPtr<ID3D11DeviceContext>& deviceContext) noexcept
+bool Renderer::Init(GraphicContext* context) noexcept
 {
-	_device = device;
-	_deviceContext = deviceContext;
+	_context = context;
 
-    CreateShaders();
-	CreateBuffers();
-	CreateStates();
+	GraphicDevice* graphicDevice = Engine::GetInstance()->GetDevice();
+	SetScreenSize(graphicDevice->GetWidth(), graphicDevice->GetHeight());
+
+	if (_context == nullptr)
+	{
+		return true;
+	}
+
+	if (!_context->CreateResources(_quadBatch.GetMaxQuads(), _instanceBatch.GetMaxInstances()))
+	{
+		return false;
+	}
+
+	_quadBatch.SetBackend(this);
+	_instanceBatch.SetBackend(this);
+	_stateCache.Invalidate();
 
 	return true;
 }
 
-void Renderer::Draw(Texture* texture, const Matrix& worldMatrix) noexcept
+void Renderer::Begin(RenderSnapshot& snapshot) noexcept
+{
+    _snapshot = &snapshot;
+    _snapshot->Clear();
+    _renderQueue.Clear();
+    _cullingStats = CullingStats{};
+    _frameIndex++;
+}
+
+void Renderer::Submit(Texture* texture, const Matrix& worldMatrix, const Color& color) noexcept
+{
+    Submit(texture, worldMatrix, Vector4(0.0f, 0.0f, 1.0f, 1.0f), color);
+}
+
+void Renderer::Submit(Texture* texture, const Matrix& worldMatrix, const Vector4& uvRect, const Color& color,
+    uint8 layer, BlendMode blendMode) noexcept
+{
+    assert(_snapshot != nullptr);
+
+    texture->MarkUsed(_frameIndex);
+
+    DrawItem drawItem;
+    drawItem._texture = texture;
+    drawItem._layer = layer;
+    drawItem._blendMode = blendMode;
+    InstanceBatch::Pack(drawItem._instance, worldMatrix, uvRect, color);
+    drawItem._bounds = Bounds::FromQuad(drawItem._instance);
+
+    _renderQueue.Push(RenderQueue::MakeKey(layer, blendMode, texture->GetId(), drawItem._instance._translation.z),
+        static_cast<uint32>(_snapshot->_drawItems.size()));
+    _snapshot->_drawItems.push_back(drawItem);
+}
+
+void Renderer::SubmitUpload(Texture* texture, uint32 x, uint32 y, uint32 width, uint32 height, const uint8* data) noexcept
+{
+    assert(_snapshot != nullptr);
+    assert(texture != nullptr && data != nullptr);
+
+    TextureUpload upload;
+    upload._texture = texture;
+    upload._x = x;
+    upload._y = y;
+    upload._width = width;
+    upload._height = height;
+    upload._dataOffset = _snapshot->_uploadData.size();
+
+    _snapshot->_uploadData.insert(_snapshot->_uploadData.end(), data, data + static_cast<size_t>(width) * height * 4);
+    _snapshot->_uploads.push_back(upload);
+}
+
+void Renderer::End() noexcept
 {
-    D3D11_MAPPED_SUBRESOURCE mappedResource;
-    ASSERT_HR(_deviceContext->Map(_quadConstantBuffer.Get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource));
+    assert(_snapshot != nullptr);
+
+    _renderQueue.Sort();
+
+    if (_cameras.empty())
+    {
+        AddView(_defaultViewMatrix * _defaultProjectionMatrix,
+            Vector4(0.0f, 0.0f, _screenSize.x, _screenSize.y), _defaultViewBounds);
+    }
+    else
+    {
+        std::stable_sort(_cameras.begin(), _cameras.end(),
+            [](const Camera* lhs, const Camera* rhs)
+            {
+                return lhs->GetDepth() < rhs->GetDepth();
+            });
+
+        for (Camera* camera : _cameras)
+        {
+            if (camera->IsEnabled())
+            {
+                AddView(camera->GetViewProjectionMatrix(), camera->GetPixelViewport(), camera->GetViewBounds());
+            }
+        }
+    }
+
+    _snapshot = nullptr;
+}
+
+void Renderer::Render(const RenderSnapshot& snapshot) noexcept
+{
+    GraphicDevice* graphicDevice = Engine::GetInstance()->GetDevice();
+
+    _stateCache.ResetCounters();
+    _quadBatch.ResetStats();
+    _instanceBatch.ResetStats();
+
+    for (const TextureUpload& upload : snapshot._uploads)
+    {
+        upload._texture->UpdateRegion(_context, upload._x, upload._y, upload._width, upload._height,
+            snapshot._uploadData.data() + upload._dataOffset);
+    }
+
+    graphicDevice->BeginFrame();
+
+    for (const SnapshotView& view : snapshot._views)
+    {
+        RenderView(snapshot, view);
+    }
+
+    graphicDevice->EndFrame();
+}
+
+void Renderer::InvalidateState() noexcept
+{
+    _stateCache.Invalidate();
+}
+
+void Renderer::SetScreenSize(uint32 width, uint32 height) noexcept
+{
+    _screenSize = Vector2(static_cast<float>(width), static_cast<float>(height));
 
     Vector3 cameraPosition = Vector3(0.0f, 0.0f, 10.0f);
-    Vector3 targetPosition = Vector3(0.0f, 0.0f, 0.0f); 
-    Vector3 upVector = Vector3(0.0f, 1.0f, 0.0f);       
+    Vector3 targetPosition = Vector3(0.0f, 0.0f, 0.0f);
+    Vector3 upVector = Vector3(0.0f, 1.0f, 0.0f);
 
-    Matrix viewMatrix = DirectX::XMMatrixLookAtLH(
+    _defaultViewMatrix = DirectX::XMMatrixLookAtLH(
         DirectX::XMLoadFloat3(reinterpret_cast<const DirectX::XMFLOAT3*>(&cameraPosition)),
         DirectX::XMLoadFloat3(reinterpret_cast<const DirectX::XMFLOAT3*>(&targetPosition)),
         DirectX::XMLoadFloat3(reinterpret_cast<const DirectX::XMFLOAT3*>(&upVector))
     );
 
-    ComPtr<IDXGISwapChain> swapChain = Engine::GetInstance()->GetDevice()->GetSwapChain();
+    float halfWidth = _screenSize.x / 2.0f;
+    float halfHeight = _screenSize.y / 2.0f;
 
-    DXGI_SWAP_CHAIN_DESC desc;
-    swapChain->GetDesc(&desc);
-
-    float halfWidth = static_cast<float>(desc.BufferDesc.Width) / 2.0f;
-    float halfHeight = static_cast<float>(desc.BufferDesc.Height) / 2.0f;
-
-    Matrix projectionMatrix = DirectX::XMMatrixOrthographicOffCenterLH(
+    _defaultProjectionMatrix = DirectX::XMMatrixOrthographicOffCenterLH(
         halfWidth, -halfWidth,
         -halfHeight, halfHeight,
         0.0f, 1000.0f
     );
 
-    MatrixData* matrixData = static_cast<MatrixData*>(mappedResource.pData);
-    matrixData->_world = DirectX::XMMatrixTranspose(worldMatrix);
-    matrixData->_view = DirectX::XMMatrixTranspose(viewMatrix);
-    matrixData->_projection = DirectX::XMMatrixTranspose(projectionMatrix);
-
-    _deviceContext->Unmap(_quadConstantBuffer.Get(), 0);
-    _deviceContext->RSSetState(_rasterizerState.Get());
-
-    float blendFactor[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
-    _deviceContext->OMSetBlendState(_blendState.Get(), blendFactor, 0xffffffff);
-    _deviceContext->VSSetShader(_vertexShader.Get(), nullptr, 0);
-    _deviceContext->PSSetShader(_pixelShader.Get(), nullptr, 0);
-    _deviceContext->IASetInputLayout(_inputLayout.Get());
+    _defaultViewBounds = Bounds(Vector2(-halfWidth, -halfHeight), Vector2(halfWidth, halfHeight));
+}
 
-    _deviceContext->VSSetConstantBuffers(0, 1, _quadConstantBuffer.GetAddressOf());
+void Renderer::AddCamera(Camera* camera) noexcept
+{
+    assert(camera != nullptr);
 
-    ID3D11ShaderResourceView* shaderResourceView = texture->GetShaderResourceView();
-    _deviceContext->PSSetShaderResources(0, 1, &shaderResourceView);
-    _deviceContext->PSSetSamplers(0, 1, _samplerState.GetAddressOf());
+    _cameras.push_back(camera);
+}
 
-    UINT stride = sizeof(Vertex);
-    UINT offset = 0;
-    _deviceContext->IASetVertexBuffers(0, 1, _quadVertexBuffer.GetAddressOf(), &stride, &offset);
-    _deviceContext->IASetIndexBuffer(_quadIndexBuffer.Get(), DXGI_FORMAT_R32_UINT, 0);
-    _deviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-    _deviceContext->DrawIndexed(6, 0, 0);
+void Renderer::RemoveCamera(Camera* camera) noexcept
+{
+    _cameras.erase(std::remove(_cameras.begin(), _cameras.end(), camera), _cameras.end());
 }
 
-bool Renderer::CreateShaders() noexcept
+bool Renderer::IsVisible(const Bounds& bounds) const noexcept
 {
-    const char* vertexShaderSource = R"(
-        cbuffer MatrixBuffer : register(b0)
-        {
-            matrix World;
-            matrix View;
-            matrix Projection;
-        };
+    if (!_isCullingEnabled)
+    {
+        return true;
+    }
 
-        struct VS_INPUT
-        {
-            float3 Position : POSITION;
-            float2 TexCoord : TEXCOORD;
-        };
+    if (_cameras.empty())
+    {
+        return _defaultViewBounds.Intersects(bounds);
+    }
 
-        struct PS_INPUT
+    for (const Camera* camera : _cameras)
+    {
+        if (camera->IsEnabled() && camera->GetViewBounds().Intersects(bounds))
         {
-            float4 Position : SV_POSITION;
-            float2 TexCoord : TEXCOORD;
-        };
+            return true;
+        }
+    }
 
-        PS_INPUT main(VS_INPUT input)
+    return false;
+}
+
+void Renderer::AddView(const Matrix& viewProjectionMatrix, const Vector4& viewport, const Bounds& viewBounds) noexcept
+{
+    SnapshotView view;
+    view._viewProjection = viewProjectionMatrix;
+    view._viewport = viewport;
+    view._firstItem = static_cast<uint32>(_snapshot->_visibleItems.size());
+
+    for (const RenderQueueEntry& entry : _renderQueue.GetEntries())
+    {
+        if (_isCullingEnabled && !viewBounds.Intersects(_snapshot->_drawItems[entry._index]._bounds))
         {
-            PS_INPUT output;
-            
-            float4 worldPos = mul(float4(input.Position, 1.0f), World);
-            float4 viewPos = mul(worldPos, View);
-            output.Position = mul(viewPos, Projection);
-            output.TexCoord = input.TexCoord;
-            
-            return output;
+            ++_cullingStats._culledCount;
+            continue;
         }
-    )";
 
-    ComPtr<ID3DBlob> vertexShaderBlob;
-    ComPtr<ID3DBlob> errorBlob;
+        ++_cullingStats._visibleCount;
+        _snapshot->_visibleItems.push_back(entry._index);
+    }
 
-    ASSERT_HR(D3DCompile(vertexShaderSource, strlen(vertexShaderSource),
-        nullptr, nullptr, nullptr, "main", "vs_5_0", D3DCOMPILE_ENABLE_STRICTNESS,
-        0, &vertexShaderBlob, &errorBlob));
+    view._itemCount = static_cast<uint32>(_snapshot->_visibleItems.size()) - view._firstItem;
+    _snapshot->_views.push_back(view);
+}
 
-    ASSERT_HR(_device->CreateVertexShader(vertexShaderBlob->GetBufferPointer(),
-        vertexShaderBlob->GetBufferSize(), nullptr, &_vertexShader));
+void Renderer::RenderView(const RenderSnapshot& snapshot, const SnapshotView& view) noexcept
+{
+    _context->SetViewport(view._viewport);
 
-    D3D11_INPUT_ELEMENT_DESC layout[] =
-    {
-        { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
-        { "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 }
-    };
+    ViewProjectionData viewProjectionData;
+    viewProjectionData._viewProjection = DirectX::XMMatrixTranspose(view._viewProjection);
+    _context->UpdateBuffer(GraphicBuffer::ViewProjection, &viewProjectionData, sizeof(viewProjectionData));
 
-    ASSERT_HR(_device->CreateInputLayout(layout, ARRAYSIZE(layout), 
-        vertexShaderBlob->GetBufferPointer(), vertexShaderBlob->GetBufferSize(), &_inputLayout));
+    const uint32* visibleItems = snapshot._visibleItems.data() + view._firstItem;
 
-    const char* pixelShaderSource = R"(
-        Texture2D MainTexture : register(t0);
-        SamplerState MainSampler : register(s0);
+    if (_renderMode == RenderMode::Instanced)
+    {
+        _instanceBatch.Begin();
 
-        struct PS_INPUT
+        for (uint32 i = 0; i < view._itemCount; ++i)
         {
-            float4 Position : SV_POSITION;
-            float2 TexCoord : TEXCOORD;
-        };
+            const DrawItem& drawItem = snapshot._drawItems[visibleItems[i]];
+            _instanceBatch.Submit(drawItem._texture, drawItem._instance, drawItem._blendMode);
+        }
+
+        _instanceBatch.End();
+    }
+    else
+    {
+        _quadBatch.Begin();
 
-        float4 main(PS_INPUT input) : SV_TARGET
+        for (uint32 i = 0; i < view._itemCount; ++i)
         {
-            return MainTexture.Sample(MainSampler, input.TexCoord);
+            const DrawItem& drawItem = snapshot._drawItems[visibleItems[i]];
+            _quadBatch.Submit(drawItem._texture, drawItem._instance, drawItem._blendMode);
         }
-    )";
 
-    ComPtr<ID3DBlob> pixelShaderBlob;
+        _quadBatch.End();
+    }
+}
+
+void Renderer::Flush(const BatchVertex* vertices, uint32 quadCount,
+    const BatchRange* ranges, uint32 rangeCount) noexcept
+{
+    _context->UpdateBuffer(GraphicBuffer::BatchVertex, vertices, sizeof(BatchVertex) * 4 * quadCount);
 
-    ASSERT_HR(D3DCompile(pixelShaderSource, strlen(pixelShaderSource),
-        nullptr, nullptr, nullptr, "main", "ps_5_0",
-        D3DCOMPILE_ENABLE_STRICTNESS, 0, &pixelShaderBlob, &errorBlob));
+    BindPipeline(GraphicShader::BatchVertex, GraphicShader::SpritePixel, GraphicInputLayout::Batch, GraphicBuffer::ViewProjection);
+    BindVertexBuffer(0, GraphicBuffer::BatchVertex, sizeof(BatchVertex));
+    BindIndexBuffer(GraphicBuffer::BatchIndex);
 
-    ASSERT_HR(_device->CreatePixelShader(pixelShaderBlob->GetBufferPointer(),
-        pixelShaderBlob->GetBufferSize(), nullptr, &_pixelShader));
+    for (uint32 i = 0; i < rangeCount; ++i)
+    {
+        const BatchRange& range = ranges[i];
 
-    return true;
+        BindBlendState(range._blendMode);
+        BindTexture(range._texture);
+        _context->DrawIndexed(range._quadCount * 6, range._firstQuad * 6);
+    }
 }
 
-bool Renderer::CreateBuffers() noexcept
+void Renderer::Flush(const InstanceData* instances, uint32 instanceCount,
+    const BatchRange* ranges, uint32 rangeCount) noexcept
 {
-    Vertex vertices[] = {
-        { 0.0f, 1.0f, 0.0f, 0.0f, 0.0f },
-        { 1.0f, 1.0f, 0.0f, 1.0f, 0.0f },
-        { 1.0f, 0.0f, 0.0f, 1.0f, 1.0f },
-        { 0.0f, 0.0f, 0.0f, 0.0f, 1.0f } 
-    };
+    _context->UpdateBuffer(GraphicBuffer::Instance, instances, sizeof(InstanceData) * instanceCount);
 
-    D3D11_BUFFER_DESC vertexBufferDesc = {};
-    vertexBufferDesc.Usage = D3D11_USAGE_DEFAULT;
-    vertexBufferDesc.ByteWidth = sizeof(vertices);
-    vertexBufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-    vertexBufferDesc.CPUAccessFlags = 0;
+    BindPipeline(GraphicShader::InstanceVertex, GraphicShader::SpritePixel, GraphicInputLayout::Instance, GraphicBuffer::ViewProjection);
+    BindVertexBuffer(0, GraphicBuffer::QuadVertex, sizeof(Vertex));
+    BindVertexBuffer(1, GraphicBuffer::Instance, sizeof(InstanceData));
+    BindIndexBuffer(GraphicBuffer::QuadIndex);
 
-    D3D11_SUBRESOURCE_DATA vertexBufferData = {};
-    vertexBufferData.pSysMem = vertices;
+    for (uint32 i = 0; i < rangeCount; ++i)
+    {
+        const BatchRange& range = ranges[i];
 
-    ASSERT_HR(_device->CreateBuffer(&vertexBufferDesc, &vertexBufferData, &_quadVertexBuffer));
+        BindBlendState(range._blendMode);
+        BindTexture(range._texture);
+        _context->DrawIndexedInstanced(6, range._quadCount, range._firstQuad);
+    }
+}
 
-    uint32 indices[] = {
-        0, 1, 2,
-        0, 2, 3
-    };
+void Renderer::BindPipeline(GraphicShader vertexShader, GraphicShader pixelShader,
+    GraphicInputLayout inputLayout, GraphicBuffer constantBuffer) noexcept
+{
+    if (_stateCache.Bind(RenderBinding::RasterizerState, 0))
+    {
+        _context->SetRasterizerState();
+    }
 
-    D3D11_BUFFER_DESC indexBufferDesc = {};
-    indexBufferDesc.Usage = D3D11_USAGE_DEFAULT;
-    indexBufferDesc.ByteWidth = sizeof(indices);
-    indexBufferDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
-    indexBufferDesc.CPUAccessFlags = 0;
+    if (_stateCache.Bind(RenderBinding::VertexShader, static_cast<uint64>(vertexShader)))
+    {
+        _context->SetVertexShader(vertexShader);
+    }
 
-    D3D11_SUBRESOURCE_DATA indexBufferData = {};
-    indexBufferData.pSysMem = indices;
+    if (_stateCache.Bind(RenderBinding::PixelShader, static_cast<uint64>(pixelShader)))
+    {
+        _context->SetPixelShader(pixelShader);
+    }
 
-    ASSERT_HR(_device->CreateBuffer(&indexBufferDesc, &indexBufferData, &_quadIndexBuffer));
+    if (_stateCache.Bind(RenderBinding::InputLayout, static_cast<uint64>(inputLayout)))
+    {
+        _context->SetInputLayout(inputLayout);
+    }
 
-    D3D11_BUFFER_DESC constantBufferDesc = {};
-    constantBufferDesc.Usage = D3D11_USAGE_DYNAMIC;
-    constantBufferDesc.ByteWidth = sizeof(MatrixData);
-    constantBufferDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
-    constantBufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+    if (_stateCache.Bind(RenderBinding::ConstantBuffer, static_cast<uint64>(constantBuffer)))
+    {
+        _context->SetConstantBuffer(constantBuffer);
+    }
 
-    ASSERT_HR(_device->CreateBuffer(&constantBufferDesc, nullptr, &_quadConstantBuffer));
+    if (_stateCache.Bind(RenderBinding::Sampler, 0))
+    {
+        _context->SetSampler();
+    }
 
-    return true;
+    if (_stateCache.Bind(RenderBinding::Topology, 0))
+    {
+        _context->SetTopology();
+    }
 }
 
-bool Renderer::CreateStates() noexcept
+void Renderer::BindBlendState(BlendMode blendMode) noexcept
 {
-    D3D11_RASTERIZER_DESC rasterizerDesc = {};
-    rasterizerDesc.FillMode = D3D11_FILL_SOLID;
-    rasterizerDesc.CullMode = D3D11_CULL_NONE;
-    rasterizerDesc.FrontCounterClockwise = FALSE;
-    rasterizerDesc.DepthClipEnable = TRUE;
-
-    ASSERT_HR(_device->CreateRasterizerState(&rasterizerDesc, &_rasterizerState));
+    if (_stateCache.Bind(RenderBinding::BlendState, static_cast<uint64>(blendMode)))
+    {
+        _context->SetBlendState(blendMode);
+    }
+}
 
-    D3D11_SAMPLER_DESC samplerDesc = {};
-    samplerDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
-    samplerDesc.AddressU = D3D11_TEXTURE_ADDRESS_CLAMP;
-    samplerDesc.AddressV = D3D11_TEXTURE_ADDRESS_CLAMP;
-    samplerDesc.AddressW = D3D11_TEXTURE_ADDRESS_CLAMP;
-    samplerDesc.MipLODBias = 0.0f;
-    samplerDesc.MaxAnisotropy = 1;
-    samplerDesc.ComparisonFunc = D3D11_COMPARISON_NEVER;
-    samplerDesc.MinLOD = 0.0f;
-    samplerDesc.MaxLOD = D3D11_FLOAT32_MAX;
+void Renderer::BindVertexBuffer(uint32 slot, GraphicBuffer vertexBuffer, uint32 stride) noexcept
+{
+    assert(slot < 2);
 
-    ASSERT_HR(_device->CreateSamplerState(&samplerDesc, &_samplerState));
+    RenderBinding binding = slot == 0 ? RenderBinding::VertexBuffer0 : RenderBinding::VertexBuffer1;
 
-    D3D11_BLEND_DESC blendDesc = {};
-    blendDesc.AlphaToCoverageEnable = FALSE;
-    blendDesc.IndependentBlendEnable = FALSE;
-    blendDesc.RenderTarget[0].BlendEnable = TRUE;
-    blendDesc.RenderTarget[0].SrcBlend = D3D11_BLEND_SRC_ALPHA;
-    blendDesc.RenderTarget[0].DestBlend = D3D11_BLEND_INV_SRC_ALPHA;
-    blendDesc.RenderTarget[0].BlendOp = D3D11_BLEND_OP_ADD;
-    blendDesc.RenderTarget[0].SrcBlendAlpha = D3D11_BLEND_ONE;
-    blendDesc.RenderTarget[0].DestBlendAlpha = D3D11_BLEND_ZERO;
-    blendDesc.RenderTarget[0].BlendOpAlpha = D3D11_BLEND_OP_ADD;
-    blendDesc.RenderTarget[0].RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL;
+    if (_stateCache.Bind(binding, static_cast<uint64>(vertexBuffer)))
+    {
+        _context->SetVertexBuffer(slot, vertexBuffer, stride);
+    }
+}
 
-    ASSERT_HR(_device->CreateBlendState(&blendDesc, &_blendState));
+void Renderer::BindIndexBuffer(GraphicBuffer indexBuffer) noexcept
+{
+    if (_stateCache.Bind(RenderBinding::IndexBuffer, static_cast<uint64>(indexBuffer)))
+    {
+        _context->SetIndexBuffer(indexBuffer);
+    }
+}
 
-    return true;
+void Renderer::BindTexture(Texture* texture) noexcept
+{
+    if (_stateCache.Bind(RenderBinding::ShaderResource, _context->GetTextureBinding(texture)))
+    {
+        _context->SetTexture(texture);
+    }
 }
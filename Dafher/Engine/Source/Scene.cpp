@@ -1,9 +1,13 @@
 #include "Scene.h"
 #include "Sprite.h"
 #include "Movement.h"
+#include "Engine.h"
+#include "TextureManager.h"
 
 bool Scene::Init()
 {
+	Engine::GetInstance()->GetTextureManager()->Preload(_preloadTextures);
+
 	Node::Init();
 	SetName("Scene");
 
@@ -0,0 +1,383 @@
+#include "SoftwareRenderer.h"
+#include "Texture.h"
+#include "Platform.h"
+
+#ifdef _WIN32
+#define STBIW_WINDOWS_UTF8
+#endif
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+
+#include "stb_image_write.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define SOFTWARE_RENDERER_SSE2
+#endif
+
+#ifdef SOFTWARE_RENDERER_SSE2
+
+static inline __m128 LoadTexel(const uint8* texel) noexcept
+{
+    int32 packed;
+    memcpy(&packed, texel, sizeof(packed));
+
+    __m128i value = _mm_cvtsi32_si128(packed);
+    value = _mm_unpacklo_epi8(value, _mm_setzero_si128());
+    value = _mm_unpacklo_epi16(value, _mm_setzero_si128());
+
+    return _mm_cvtepi32_ps(value);
+}
+
+static inline void StoreTexel(uint8* texel, __m128 value) noexcept
+{
+    value = _mm_min_ps(_mm_max_ps(value, _mm_setzero_ps()), _mm_set1_ps(255.0f));
+
+    __m128i packed = _mm_cvtps_epi32(value);
+    packed = _mm_packs_epi32(packed, packed);
+    packed = _mm_packus_epi16(packed, packed);
+
+    int32 result = _mm_cvtsi128_si32(packed);
+    memcpy(texel, &result, sizeof(result));
+}
+
+#endif
+
+SoftwareRenderer::SoftwareRenderer(uint32 width, uint32 height, uint32 threadCount) noexcept
+    : _nextTile(0)
+    , _pixelCount(0)
+    , _clearColor(0.0f, 0.0f, 0.0f, 1.0f)
+    , _stats{}
+    , _width(0)
+    , _height(0)
+    , _tilesX(0)
+    , _tilesY(0)
+    , _threadCount(threadCount)
+{
+    if (_threadCount == 0)
+    {
+        _threadCount = MAX(1u, std::thread::hardware_concurrency());
+    }
+
+    Resize(width, height);
+}
+
+void SoftwareRenderer::Render(const RenderSnapshot& snapshot) noexcept
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    _stats = SoftwareRenderStats{};
+    _stats._threadCount = _threadCount;
+    _pixelCount = 0;
+
+    Clear();
+
+    for (const TextureUpload& upload : snapshot._uploads)
+    {
+        upload._texture->UpdateRegion(nullptr, upload._x, upload._y, upload._width, upload._height,
+            snapshot._uploadData.data() + upload._dataOffset);
+    }
+
+    for (const SnapshotView& view : snapshot._views)
+    {
+        _stats._spriteCount += view._itemCount;
+
+        BinView(snapshot, view);
+        RasterizeTiles();
+    }
+
+    std::chrono::duration<float, std::milli> renderTime = std::chrono::steady_clock::now() - start;
+
+    _stats._pixelCount = _pixelCount;
+    _stats._renderTime = renderTime.count();
+
+    if (_stats._renderTime > 0.0f)
+    {
+        _stats._spritesPerSecond = _stats._spriteCount * 1000.0f / _stats._renderTime;
+        _stats._megapixelsPerSecond = static_cast<float>(_stats._pixelCount) / (_stats._renderTime * 1000.0f);
+    }
+}
+
+void SoftwareRenderer::Resize(uint32 width, uint32 height) noexcept
+{
+    _width = width;
+    _height = height;
+    _tilesX = (width + TILE_SIZE - 1) / TILE_SIZE;
+    _tilesY = (height + TILE_SIZE - 1) / TILE_SIZE;
+
+    _pixels.assign(static_cast<size_t>(width) * height * 4, 0);
+    _tileBins.resize(static_cast<size_t>(_tilesX) * _tilesY);
+}
+
+void SoftwareRenderer::Clear() noexcept
+{
+    const uint8 clearColor[4] =
+    {
+        static_cast<uint8>(std::nearbyint(MIN(MAX(_clearColor.x, 0.0f), 1.0f) * 255.0f)),
+        static_cast<uint8>(std::nearbyint(MIN(MAX(_clearColor.y, 0.0f), 1.0f) * 255.0f)),
+        static_cast<uint8>(std::nearbyint(MIN(MAX(_clearColor.z, 0.0f), 1.0f) * 255.0f)),
+        static_cast<uint8>(std::nearbyint(MIN(MAX(_clearColor.w, 0.0f), 1.0f) * 255.0f))
+    };
+
+    for (size_t i = 0; i < _pixels.size(); i += 4)
+    {
+        memcpy(&_pixels[i], clearColor, sizeof(clearColor));
+    }
+}
+
+bool SoftwareRenderer::SaveImage(const std::filesystem::path& filePath) const noexcept
+{
+    return stbi_write_png(Platform::ToUtf8(filePath).c_str(), static_cast<int>(_width), static_cast<int>(_height),
+        4, _pixels.data(), static_cast<int>(_width * 4)) != 0;
+}
+
+void SoftwareRenderer::BinView(const RenderSnapshot& snapshot, const SnapshotView& view) noexcept
+{
+    _quads.clear();
+
+    for (std::vector<uint32>& bin : _tileBins)
+    {
+        bin.clear();
+    }
+
+    const int32 viewMinX = MAX(0, static_cast<int32>(std::ceil(view._viewport.x - 0.5f)));
+    const int32 viewMinY = MAX(0, static_cast<int32>(std::ceil(view._viewport.y - 0.5f)));
+    const int32 viewMaxX = MIN(static_cast<int32>(_width),
+        static_cast<int32>(std::ceil(view._viewport.x + view._viewport.z - 0.5f)));
+    const int32 viewMaxY = MIN(static_cast<int32>(_height),
+        static_cast<int32>(std::ceil(view._viewport.y + view._viewport.w - 0.5f)));
+
+    const uint32* visibleItems = snapshot._visibleItems.data() + view._firstItem;
+
+    for (uint32 i = 0; i < view._itemCount; ++i)
+    {
+        const DrawItem& drawItem = snapshot._drawItems[visibleItems[i]];
+        const InstanceData& instance = drawItem._instance;
+
+        Vector2 corners[3];
+        const float localCorners[3][2] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 0.0f, 1.0f } };
+
+        for (uint32 c = 0; c < 3; ++c)
+        {
+            const float localX = localCorners[c][0];
+            const float localY = localCorners[c][1];
+
+            Vector4 world(
+                localX * instance._axes.x + localY * instance._axes.z + instance._translation.x,
+                localX * instance._axes.y + localY * instance._axes.w + instance._translation.y,
+                instance._translation.z,
+                1.0f);
+            Vector4 clip = Vector4::Transform(world, view._viewProjection);
+
+            corners[c].x = view._viewport.x + (clip.x / clip.w + 1.0f) * 0.5f * view._viewport.z;
+            corners[c].y = view._viewport.y + (1.0f - clip.y / clip.w) * 0.5f * view._viewport.w;
+        }
+
+        const Vector2 edgeU = corners[1] - corners[0];
+        const Vector2 edgeV = corners[2] - corners[0];
+        const float determinant = edgeU.x * edgeV.y - edgeU.y * edgeV.x;
+
+        if (std::fabs(determinant) < 1e-6f)
+        {
+            continue;
+        }
+
+        const Vector2 corner3 = corners[0] + edgeU + edgeV;
+        const float minPx = MIN(MIN(corners[0].x, corners[1].x), MIN(corners[2].x, corner3.x));
+        const float minPy = MIN(MIN(corners[0].y, corners[1].y), MIN(corners[2].y, corner3.y));
+        const float maxPx = MAX(MAX(corners[0].x, corners[1].x), MAX(corners[2].x, corner3.x));
+        const float maxPy = MAX(MAX(corners[0].y, corners[1].y), MAX(corners[2].y, corner3.y));
+
+        RasterQuad quad;
+        quad._texture = drawItem._texture;
+        quad._originX = corners[0].x;
+        quad._originY = corners[0].y;
+        quad._inverse[0] = edgeV.y / determinant;
+        quad._inverse[1] = -edgeV.x / determinant;
+        quad._inverse[2] = -edgeU.y / determinant;
+        quad._inverse[3] = edgeU.x / determinant;
+        quad._uvRect = instance._uvRect;
+        quad._color = instance._color;
+        quad._minX = MAX(viewMinX, static_cast<int32>(std::ceil(minPx - 0.5f)));
+        quad._minY = MAX(viewMinY, static_cast<int32>(std::ceil(minPy - 0.5f)));
+        quad._maxX = MIN(viewMaxX, static_cast<int32>(std::ceil(maxPx - 0.5f)));
+        quad._maxY = MIN(viewMaxY, static_cast<int32>(std::ceil(maxPy - 0.5f)));
+        quad._blendMode = drawItem._blendMode;
+
+        if (quad._minX >= quad._maxX || quad._minY >= quad._maxY)
+        {
+            continue;
+        }
+
+        const uint32 quadIndex = static_cast<uint32>(_quads.size());
+        _quads.push_back(quad);
+
+        for (int32 tileY = quad._minY / TILE_SIZE; tileY <= (quad._maxY - 1) / static_cast<int32>(TILE_SIZE); ++tileY)
+        {
+            for (int32 tileX = quad._minX / TILE_SIZE; tileX <= (quad._maxX - 1) / static_cast<int32>(TILE_SIZE); ++tileX)
+            {
+                _tileBins[tileY * _tilesX + tileX].push_back(quadIndex);
+                _stats._binnedCount++;
+            }
+        }
+    }
+}
+
+void SoftwareRenderer::RasterizeTiles() noexcept
+{
+    if (_quads.empty())
+    {
+        return;
+    }
+
+    const uint32 tileCount = static_cast<uint32>(_tileBins.size());
+    _nextTile = 0;
+
+    auto work = [this, tileCount]()
+    {
+        uint64 pixelCount = 0;
+
+        for (uint32 tileIndex = _nextTile.fetch_add(1); tileIndex < tileCount; tileIndex = _nextTile.fetch_add(1))
+        {
+            pixelCount += RasterizeTile(tileIndex);
+        }
+
+        _pixelCount += pixelCount;
+    };
+
+    std::vector<std::thread> workers;
+    const uint32 workerCount = MIN(_threadCount, tileCount);
+
+    for (uint32 i = 1; i < workerCount; ++i)
+    {
+        workers.emplace_back(work);
+    }
+
+    work();
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+uint64 SoftwareRenderer::RasterizeTile(uint32 tileIndex) noexcept
+{
+    const int32 tileMinX = static_cast<int32>((tileIndex % _tilesX) * TILE_SIZE);
+    const int32 tileMinY = static_cast<int32>((tileIndex / _tilesX) * TILE_SIZE);
+    const int32 tileMaxX = MIN(tileMinX + static_cast<int32>(TILE_SIZE), static_cast<int32>(_width));
+    const int32 tileMaxY = MIN(tileMinY + static_cast<int32>(TILE_SIZE), static_cast<int32>(_height));
+
+    uint64 pixelCount = 0;
+
+    for (uint32 quadIndex : _tileBins[tileIndex])
+    {
+        const RasterQuad& quad = _quads[quadIndex];
+
+        pixelCount += RasterizeQuad(quad,
+            MAX(quad._minX, tileMinX), MAX(quad._minY, tileMinY),
+            MIN(quad._maxX, tileMaxX), MIN(quad._maxY, tileMaxY));
+    }
+
+    return pixelCount;
+}
+
+uint64 SoftwareRenderer::RasterizeQuad(const RasterQuad& quad, int32 minX, int32 minY, int32 maxX, int32 maxY) noexcept
+{
+    static const uint8 WHITE_TEXEL[4] = { 255, 255, 255, 255 };
+
+    const uint8* texels = WHITE_TEXEL;
+    int32 textureWidth = 1;
+    int32 textureHeight = 1;
+
+    if (quad._texture != nullptr && quad._texture->HasImageData())
+    {
+        texels = quad._texture->GetPixels();
+        textureWidth = static_cast<int32>(quad._texture->GetOriginalWidth());
+        textureHeight = static_cast<int32>(quad._texture->GetOriginalHeight());
+    }
+
+    const float uvWidth = quad._uvRect.z - quad._uvRect.x;
+    const float uvHeight = quad._uvRect.w - quad._uvRect.y;
+    const bool isAdditive = quad._blendMode == BlendMode::Additive;
+
+    uint64 pixelCount = 0;
+
+    for (int32 y = minY; y < maxY; ++y)
+    {
+        const float dy = static_cast<float>(y) + 0.5f - quad._originY;
+        uint8* row = &_pixels[(static_cast<size_t>(y) * _width) * 4];
+
+        for (int32 x = minX; x < maxX; ++x)
+        {
+            const float dx = static_cast<float>(x) + 0.5f - quad._originX;
+            const float u = quad._inverse[0] * dx + quad._inverse[1] * dy;
+            const float v = quad._inverse[2] * dx + quad._inverse[3] * dy;
+
+            if (u < 0.0f || u >= 1.0f || v < 0.0f || v >= 1.0f)
+            {
+                continue;
+            }
+
+            const float sampleX = (quad._uvRect.x + uvWidth * u) * textureWidth - 0.5f;
+            const float sampleY = (quad._uvRect.y + uvHeight * (1.0f - v)) * textureHeight - 0.5f;
+            const float floorX = std::floor(sampleX);
+            const float floorY = std::floor(sampleY);
+            const float weightX = sampleX - floorX;
+            const float weightY = sampleY - floorY;
+
+            const int32 x0 = MIN(MAX(static_cast<int32>(floorX), 0), textureWidth - 1);
+            const int32 y0 = MIN(MAX(static_cast<int32>(floorY), 0), textureHeight - 1);
+            const int32 x1 = MIN(MAX(static_cast<int32>(floorX) + 1, 0), textureWidth - 1);
+            const int32 y1 = MIN(MAX(static_cast<int32>(floorY) + 1, 0), textureHeight - 1);
+
+            const uint8* texel00 = &texels[(static_cast<size_t>(y0) * textureWidth + x0) * 4];
+            const uint8* texel10 = &texels[(static_cast<size_t>(y0) * textureWidth + x1) * 4];
+            const uint8* texel01 = &texels[(static_cast<size_t>(y1) * textureWidth + x0) * 4];
+            const uint8* texel11 = &texels[(static_cast<size_t>(y1) * textureWidth + x1) * 4];
+            uint8* target = &row[static_cast<size_t>(x) * 4];
+
+#ifdef SOFTWARE_RENDERER_SSE2
+            const __m128 weightX4 = _mm_set1_ps(weightX);
+            const __m128 top = _mm_add_ps(LoadTexel(texel00),
+                _mm_mul_ps(_mm_sub_ps(LoadTexel(texel10), LoadTexel(texel00)), weightX4));
+            const __m128 bottom = _mm_add_ps(LoadTexel(texel01),
+                _mm_mul_ps(_mm_sub_ps(LoadTexel(texel11), LoadTexel(texel01)), weightX4));
+            const __m128 sample = _mm_add_ps(top, _mm_mul_ps(_mm_sub_ps(bottom, top), _mm_set1_ps(weightY)));
+
+            const __m128 source = _mm_mul_ps(sample, _mm_setr_ps(quad._color.x, quad._color.y, quad._color.z, quad._color.w));
+            const __m128 alpha = _mm_mul_ps(_mm_shuffle_ps(source, source, _MM_SHUFFLE(3, 3, 3, 3)), _mm_set1_ps(1.0f / 255.0f));
+            const __m128 destinationFactor = isAdditive ? _mm_set1_ps(1.0f) : _mm_sub_ps(_mm_set1_ps(1.0f), alpha);
+
+            __m128 result = _mm_add_ps(_mm_mul_ps(source, alpha), _mm_mul_ps(LoadTexel(target), destinationFactor));
+            const __m128 alphaMask = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+            result = _mm_or_ps(_mm_and_ps(alphaMask, source), _mm_andnot_ps(alphaMask, result));
+
+            StoreTexel(target, result);
+#else
+            const float color[4] = { quad._color.x, quad._color.y, quad._color.z, quad._color.w };
+            float source[4];
+
+            for (uint32 c = 0; c < 4; ++c)
+            {
+                const float top = texel00[c] + (texel10[c] - texel00[c]) * weightX;
+                const float bottom = texel01[c] + (texel11[c] - texel01[c]) * weightX;
+                source[c] = (top + (bottom - top) * weightY) * color[c];
+            }
+
+            const float alpha = source[3] * (1.0f / 255.0f);
+            const float destinationFactor = isAdditive ? 1.0f : 1.0f - alpha;
+
+            for (uint32 c = 0; c < 4; ++c)
+            {
+                float result = c == 3 ? source[3] : source[c] * alpha + target[c] * destinationFactor;
+                result = MIN(MAX(result, 0.0f), 255.0f);
+                target[c] = static_cast<uint8>(std::nearbyint(result));
+            }
+#endif
+
+            pixelCount++;
+        }
+    }
+
+    return pixelCount;
+}
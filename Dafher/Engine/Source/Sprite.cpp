@@ -5,8 +5,13 @@
 #include "Renderer.h"
 #include "Node.h"
 
-Sprite::Sprite(const std::string& textureKey) noexcept
+Sprite::Sprite(const TextureKey& textureKey) noexcept
     : Component()
+    , _handle()
+    , _variant(nullptr)
+    , _variantSource(nullptr)
+    , _flipbook(nullptr)
+    , _flipbookFrameDuration(0.0f)
     , _isPlaying(false)
     , _loop(true)
     , _isDirty(false)
@@ -15,15 +20,30 @@ Sprite::Sprite(const std::string& textureKey) noexcept
     , _color(Vector4::One)
     , _size(Vector2::Zero)
     , _anchorPoint(Vector2(0.5f, 0.5f))
+    , _layer(0)
+    , _blendMode(BlendMode::Alpha)
+    , _cachedWorldVersion(0)
+    , _isWorldDirty(true)
     , _onAnimationComplete(nullptr)
 {
-    _texture = Engine::GetInstance()->GetTextureManager()->GetTexture(textureKey);
-	_size.x = static_cast<float>(_texture->GetWidth());
-	_size.y = static_cast<float>(_texture->GetHeight());
+    TextureManager* textureManager = Engine::GetInstance()->GetTextureManager();
+    _handle = textureManager->GetHandle(textureKey);
+    _region = textureManager->Resolve(_handle);
+
+    if (_region != nullptr)
+    {
+        _size.x = static_cast<float>(_region->_width);
+        _size.y = static_cast<float>(_region->_height);
+    }
 }
 
-Sprite::Sprite(const std::string& textureKey, uint32 width, uint32 height) noexcept
+Sprite::Sprite(const TextureKey& textureKey, uint32 width, uint32 height) noexcept
     : Component()
+    , _handle()
+    , _variant(nullptr)
+    , _variantSource(nullptr)
+    , _flipbook(nullptr)
+    , _flipbookFrameDuration(0.0f)
     , _isPlaying(false)
     , _loop(true)
     , _isDirty(false)
@@ -32,10 +52,80 @@ Sprite::Sprite(const std::string& textureKey, uint32 width, uint32 height) noexc
     , _color(Vector4::One)
     , _size(Vector2(static_cast<float>(width), static_cast<float>(height)))
     , _anchorPoint(Vector2(0.5f, 0.5f))
+    , _layer(0)
+    , _blendMode(BlendMode::Alpha)
+    , _cachedWorldVersion(0)
+    , _isWorldDirty(true)
+    , _onAnimationComplete(nullptr)
+{
+    TextureManager* textureManager = Engine::GetInstance()->GetTextureManager();
+    _handle = textureManager->GetHandle(textureKey);
+    _region = textureManager->Resolve(_handle);
+}
+
+Sprite::Sprite(const TextureKey& textureKey, StreamPriority priority) noexcept
+    : Component()
+    , _handle()
+    , _variant(nullptr)
+    , _variantSource(nullptr)
+    , _flipbook(nullptr)
+    , _flipbookFrameDuration(0.0f)
+    , _isPlaying(false)
+    , _loop(true)
+    , _isDirty(false)
+    , _currentFrameIndex(0)
+    , _frameTimer(0.0f)
+    , _color(Vector4::One)
+    , _size(Vector2::Zero)
+    , _anchorPoint(Vector2(0.5f, 0.5f))
+    , _layer(0)
+    , _blendMode(BlendMode::Alpha)
+    , _cachedWorldVersion(0)
+    , _isWorldDirty(true)
     , _onAnimationComplete(nullptr)
 {
-    _texture = Engine::GetInstance()->GetTextureManager()->GetTexture(textureKey);
-    _texture->Resize(static_cast<uint32>(_size.x), static_cast<uint32>(_size.y));
+    TextureManager* textureManager = Engine::GetInstance()->GetTextureManager();
+    _handle = textureManager->RequestHandle(textureKey, priority);
+    _region = textureManager->Resolve(_handle);
+
+    if (_region != nullptr)
+    {
+        _size.x = static_cast<float>(_region->_width);
+        _size.y = static_cast<float>(_region->_height);
+    }
+}
+
+Sprite::Sprite(const Flipbook* flipbook, float frameDuration) noexcept
+    : Component()
+    , _handle()
+    , _region(nullptr)
+    , _variant(nullptr)
+    , _variantSource(nullptr)
+    , _flipbook(nullptr)
+    , _flipbookFrameDuration(0.0f)
+    , _isPlaying(false)
+    , _loop(true)
+    , _isDirty(false)
+    , _currentFrameIndex(0)
+    , _frameTimer(0.0f)
+    , _color(Vector4::One)
+    , _size(Vector2::Zero)
+    , _anchorPoint(Vector2(0.5f, 0.5f))
+    , _layer(0)
+    , _blendMode(BlendMode::Alpha)
+    , _cachedWorldVersion(0)
+    , _isWorldDirty(true)
+    , _onAnimationComplete(nullptr)
+{
+    SetFlipbook(flipbook, frameDuration);
+}
+
+Sprite::~Sprite() noexcept
+{
+    if (_variant != nullptr)
+    {
+        Engine::GetInstance()->GetTextureManager()->ReleaseVariant(_variant);
+    }
 }
 
 bool Sprite::Init()
@@ -54,49 +144,91 @@ void Sprite::Update(float delta)
 
 void Sprite::PostUpdate(float delta)
 {
-    if (_texture == nullptr)
+    if (_flipbook != nullptr)
     {
+        const FlipbookFrame& frame = _flipbook->_frames[_currentFrameIndex];
+        RefreshWorld();
+
+        Engine::GetInstance()->GetRenderer()->Submit(frame._texture, _worldMatrix,
+            frame._uvRect, _color, _layer, _blendMode);
         return;
     }
 
-    if (_isDirty)
+    TextureManager* textureManager = Engine::GetInstance()->GetTextureManager();
+    _region = textureManager->Resolve(_handle);
+
+    if (_region == nullptr)
     {
-        _texture->Resize(static_cast<uint32>(_size.x), static_cast<uint32>(_size.y));
-		_isDirty = false;
+        return;
     }
 
-    float offsetX = -_size.x * _anchorPoint.x;
-    float offsetY = -_size.y * _anchorPoint.y;
+    if (!_region->_isResident)
+    {
+        textureManager->EnsureResident(_region);
+    }
 
-    Matrix spriteScaleMatrix = DirectX::XMMatrixScaling(_size.x, _size.y, 1.0f);
-    Matrix anchorOffsetMatrix = DirectX::XMMatrixTranslation(offsetX, offsetY, 0.0f);    
-    Matrix worldMatrix = spriteScaleMatrix * anchorOffsetMatrix * _owner->_transform->GetWorldMatrix();
+    RefreshVariant();
+    RefreshWorld();
+
+    Engine::GetInstance()->GetRenderer()->Submit(_variant != nullptr ? _variant : _region->_texture, _worldMatrix,
+        _region->_uvRect, _color, _layer, _blendMode);
+}
 
-    Engine::GetInstance()->GetRenderer()->Draw(_texture, worldMatrix);
+bool Sprite::GetWorldBounds(Bounds& bounds) const
+{
+    if ((_region == nullptr && _flipbook == nullptr) || _owner == nullptr)
+    {
+        return false;
+    }
+
+    RefreshWorld();
+    bounds = _worldBounds;
+
+    return true;
 }
 
-void Sprite::AddFrame(const std::string& textureKey, float duration)
+void Sprite::AddFrame(const TextureKey& textureKey, float duration)
 {
-    auto texture = Engine::GetInstance()->GetTextureManager()->GetTexture(textureKey);
-    _textures.push_back(texture);
+    TextureHandle handle = Engine::GetInstance()->GetTextureManager()->GetHandle(textureKey);
+    _frames.push_back(handle);
     _frameDurations.push_back(duration);
 }
 
+void Sprite::SetFlipbook(const Flipbook* flipbook, float frameDuration) noexcept
+{
+    assert(flipbook == nullptr || !flipbook->_frames.empty());
+
+    _flipbook = flipbook;
+    _flipbookFrameDuration = frameDuration;
+    _currentFrameIndex = 0;
+    _frameTimer = 0.0f;
+
+    if (_flipbook != nullptr && _size == Vector2::Zero)
+    {
+        _size.x = static_cast<float>(_flipbook->_frameWidth);
+        _size.y = static_cast<float>(_flipbook->_frameHeight);
+        _isWorldDirty = true;
+    }
+}
+
 void Sprite::UpdateAnimation(float delta) noexcept
 {
-    if (!IsPlaying() || _textures.empty())
+    const size_t frameCount = GetFrameCount();
+
+    if (!IsPlaying() || frameCount == 0)
     {
         return;
 	}
 
+    const float frameDuration = _flipbook != nullptr ? _flipbookFrameDuration : _frameDurations[_currentFrameIndex];
     _frameTimer += delta;
 
-    if (_frameTimer >= _frameDurations[_currentFrameIndex])
+    if (_frameTimer >= frameDuration)
     {
-        _frameTimer -= _frameDurations[_currentFrameIndex];
+        _frameTimer -= frameDuration;
         _currentFrameIndex++;
 
-        if (_currentFrameIndex >= _textures.size())
+        if (_currentFrameIndex >= frameCount)
         {
             if (_loop)
             {
@@ -108,11 +240,71 @@ void Sprite::UpdateAnimation(float delta) noexcept
             }
 			else
             {
-                _currentFrameIndex = _textures.size() - 1;
+                _currentFrameIndex = static_cast<uint32>(frameCount - 1);
                 return;
             }
         }
 
-        _texture = _textures[_currentFrameIndex];
+        if (_currentFrameIndex >= frameCount)
+        {
+            _currentFrameIndex = static_cast<uint32>(frameCount - 1);
+        }
+
+        if (_flipbook == nullptr)
+        {
+            _handle = _frames[_currentFrameIndex];
+        }
     }
 }
+
+void Sprite::RefreshWorld() const noexcept
+{
+    const Transform* transform = _owner->_transform;
+    const uint32 worldVersion = transform->GetWorldVersion();
+
+    if (!_isWorldDirty && _cachedWorldVersion == worldVersion)
+    {
+        return;
+    }
+
+    float offsetX = -_size.x * _anchorPoint.x;
+    float offsetY = -_size.y * _anchorPoint.y;
+
+    Matrix spriteScaleMatrix = DirectX::XMMatrixScaling(_size.x, _size.y, 1.0f);
+    Matrix anchorOffsetMatrix = DirectX::XMMatrixTranslation(offsetX, offsetY, 0.0f);
+    _worldMatrix = spriteScaleMatrix * anchorOffsetMatrix * transform->GetWorldMatrix();
+    _worldBounds = Bounds::FromQuad(_worldMatrix);
+
+    _cachedWorldVersion = worldVersion;
+    _isWorldDirty = false;
+}
+
+void Sprite::RefreshVariant() noexcept
+{
+    const uint32 width = static_cast<uint32>(_size.x);
+    const uint32 height = static_cast<uint32>(_size.y);
+    const Texture* source = nullptr;
+
+    if (!_region->_isAtlased && _region->_isResident && !_region->_texture->IsCompressed() && width > 0 && height > 0 &&
+        (_region->_texture->GetWidth() != width || _region->_texture->GetHeight() != height))
+    {
+        source = _region->_texture;
+    }
+
+    if (!_isDirty && source == _variantSource)
+    {
+        return;
+    }
+
+    TextureManager* textureManager = Engine::GetInstance()->GetTextureManager();
+    Texture* variant = source != nullptr ? textureManager->AcquireVariant(source, width, height) : nullptr;
+
+    if (_variant != nullptr)
+    {
+        textureManager->ReleaseVariant(_variant);
+    }
+
+    _variant = variant;
+    _variantSource = source;
+    _isDirty = false;
+}
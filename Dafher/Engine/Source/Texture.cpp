@@ -1,4 +1,7 @@
-#include "Texture.h"
+﻿#include "Texture.h"
+#include "DdsFile.h"
+#include "ImageResizer.h"
+#include "FileIO.h"
 
 #define STB_IMAGE_IMPLEMENTATION
 #define STB_IMAGE_RESIZE2_IMPLEMENTATION
@@ -6,31 +9,58 @@
 #include "stb_image.h"
 #include "stb_image_resize2.h"
 
-bool Texture::LoadFromFile(const ComPtr<ID3D11Device>& device, const std::wstring& filePath) noexcept
+bool Texture::LoadFromFile(GraphicContext* context, const std::filesystem::path& filePath) noexcept
 {
-    _device = device;
-
-    std::ifstream file(filePath, std::ios::binary | std::ios::ate);
-    assert(file.is_open());
+    if (!LoadImageFromFile(filePath) || !GenerateMips())
+    {
+        return false;
+    }
 
-    std::streamsize fileSize = file.tellg();
-    file.seekg(0, std::ios::beg);
+    return CreateDeviceResources(context);
+}
 
-    std::vector<unsigned char> buffer(fileSize);
-    bool readSuccess = file.read(reinterpret_cast<char*>(buffer.data()), fileSize).good();
+bool Texture::LoadImageFromFile(const std::filesystem::path& filePath) noexcept
+{
+    IoBuffer buffer;
+    bool readSuccess = buffer.Load(filePath);
     assert(readSuccess);
 
-    bool isLoaded = LoadImageData(buffer.data(), buffer.size());
+    return readSuccess && LoadImageFromMemory(buffer.GetData(), static_cast<size_t>(buffer.GetSize()));
+}
+
+bool Texture::LoadImageFromMemory(const void* data, size_t dataSize) noexcept
+{
+    bool isLoaded = LoadImageData(data, dataSize);
 	assert(isLoaded);
 
     _width = _originalWidth;
     _height = _originalHeight;
 
+    return isLoaded;
+}
+
+bool Texture::CreateFromImageData(GraphicContext* context,
+    std::vector<unsigned char>&& imageData, uint32 width, uint32 height) noexcept
+{
+    SetImageData(std::move(imageData), width, height);
+
+    return CreateDeviceResources(context);
+}
+
+bool Texture::CreateDeviceResources(GraphicContext* context) noexcept
+{
+    _context = context;
+
     return CreateTexture();
 }
 
 bool Texture::LoadImageData(const void* data, size_t dataSize) noexcept
 {
+    if (DdsFile::IsDds(data, dataSize))
+    {
+        return LoadDdsData(data, dataSize);
+    }
+
     int channels;
     int imageWidth, imageHeight;
     unsigned char* imageData = stbi_load_from_memory(
@@ -43,7 +73,6 @@ bool Texture::LoadImageData(const void* data, size_t dataSize) noexcept
 
     _originalWidth = static_cast<uint32>(imageWidth);
     _originalHeight = static_cast<uint32>(imageHeight);
-    _format = DXGI_FORMAT_R8G8B8A8_UNORM;
 
     size_t dataLength = _originalWidth * _originalHeight * 4;
     _originalImageData.assign(imageData, imageData + dataLength);
@@ -53,75 +82,250 @@ bool Texture::LoadImageData(const void* data, size_t dataSize) noexcept
     return true;
 }
 
-bool Texture::Resize(uint32 width, uint32 height) noexcept
+bool Texture::CreateResized(GraphicContext* context, const Texture& source, uint32 width, uint32 height,
+    ThreadPool* threadPool) noexcept
+{
+    assert(source.HasImageData());
+    assert(width > 0 && height > 0);
+
+    std::vector<unsigned char> imageData(static_cast<size_t>(width) * height * 4);
+    ImageResizer::Resize(source.GetPixels(), source._originalWidth, source._originalHeight,
+        imageData.data(), width, height, threadPool);
+
+    SetImageData(std::move(imageData), width, height);
+
+    if (!GenerateMips(threadPool))
+    {
+        return false;
+    }
+
+    return CreateDeviceResources(context);
+}
+
+bool Texture::GenerateMips(ThreadPool* threadPool) noexcept
 {
-    if (_width == width && _height == height && _texture2D != nullptr)
+    if (IsCompressed() || IsMapped() || _mipLevels > 1)
     {
         return true;
     }
 
+    assert(HasImageData());
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    _mipLevels = CalculateMipLevels(_originalWidth, _originalHeight);
+
+    size_t chainSize = 0;
+
+    for (uint32 level = 1; level < _mipLevels; ++level)
+    {
+        chainSize += static_cast<size_t>(MAX(1u, _originalWidth >> level)) * MAX(1u, _originalHeight >> level) * 4;
+    }
+
+    _mipChainData.resize(chainSize);
+
+    const unsigned char* sourceData = _originalImageData.data();
+    uint32 sourceWidth = _originalWidth;
+    uint32 sourceHeight = _originalHeight;
+    unsigned char* targetData = _mipChainData.data();
+
+    for (uint32 level = 1; level < _mipLevels; ++level)
+    {
+        const uint32 targetWidth = MAX(1u, sourceWidth >> 1);
+        const uint32 targetHeight = MAX(1u, sourceHeight >> 1);
+
+        ImageResizer::Resize(sourceData, sourceWidth, sourceHeight, targetData, targetWidth, targetHeight, threadPool);
+
+        sourceData = targetData;
+        sourceWidth = targetWidth;
+        sourceHeight = targetHeight;
+        targetData += static_cast<size_t>(targetWidth) * targetHeight * 4;
+    }
+
+    std::chrono::duration<float, std::milli> mipTime = std::chrono::steady_clock::now() - startTime;
+    _mipGenerationTime = mipTime.count();
+
+    return true;
+}
+
+void Texture::SetCompressedImage(CompressedImage&& image) noexcept
+{
+    assert(image._format != BlockFormat::None);
+
+    _compressedData = std::move(image._data);
+    _mappedData = nullptr;
+    _mappedSize = 0;
+    _blockFormat = image._format;
+    _originalWidth = image._width;
+    _originalHeight = image._height;
+    _width = image._width;
+    _height = image._height;
+    _mipLevels = image._mipLevels;
+}
+
+void Texture::ReleaseImageData() noexcept
+{
+    std::vector<unsigned char>().swap(_originalImageData);
+    std::vector<unsigned char>().swap(_mipChainData);
+    std::vector<uint8>().swap(_compressedData);
+    _mappedData = nullptr;
+    _mappedSize = 0;
+}
+
+void Texture::UpdateRegion(GraphicContext* context,
+    uint32 x, uint32 y, uint32 width, uint32 height, const uint8* data) noexcept
+{
+    assert(data != nullptr);
+    assert(x + width <= _width && y + height <= _height);
+    assert(!IsCompressed() && !IsMapped());
+
+    const size_t rowSize = static_cast<size_t>(width) * 4;
+
+    if (!_originalImageData.empty())
+    {
+        for (uint32 row = 0; row < height; ++row)
+        {
+            std::memcpy(_originalImageData.data() + ((static_cast<size_t>(y) + row) * _width + x) * 4,
+                data + row * rowSize, rowSize);
+        }
+    }
+
+    if (context != nullptr)
+    {
+        context->UpdateTexture(this, x, y, width, height, data);
+    }
+}
+
+bool Texture::SetMappedImage(const uint8* data, size_t dataSize, BlockFormat format,
+    uint32 width, uint32 height, uint32 mipLevels) noexcept
+{
+    assert(data != nullptr);
+
+    if (width == 0 || height == 0 || mipLevels == 0 || mipLevels > CalculateMipLevels(width, height) ||
+        dataSize != CalculateDataSize(format, width, height, mipLevels) ||
+        (format != BlockFormat::None && (width % 4 != 0 || height % 4 != 0)))
+    {
+        return false;
+    }
+
+    _originalImageData.clear();
+    _mipChainData.clear();
+    _compressedData.clear();
+    _mappedData = data;
+    _mappedSize = dataSize;
+    _blockFormat = format;
+    _originalWidth = width;
+    _originalHeight = height;
     _width = width;
     _height = height;
+    _mipLevels = mipLevels;
+    _mipGenerationTime = 0.0f;
 
-    return CreateTexture();
+    return true;
 }
 
-bool Texture::CreateTexture() noexcept
+uint32 Texture::CalculateMipLevels(uint32 width, uint32 height) noexcept
+{
+    uint32 levels = 1;
+
+    for (uint32 size = MAX(width, height); size > 1; size >>= 1)
+    {
+        ++levels;
+    }
+
+    return levels;
+}
+
+size_t Texture::CalculateDataSize(BlockFormat format, uint32 width, uint32 height, uint32 mipLevels) noexcept
 {
-	std::vector<unsigned char> finalImageData;
-    bool needResize = (_width != _originalWidth) || (_height != _originalHeight);
+    size_t dataSize = 0;
 
-    if (needResize)
+    for (uint32 level = 0; level < mipLevels; ++level)
     {
-		finalImageData.assign(_width * _height * 4, 0);
-        stbir_resize_uint8_linear(
-            _originalImageData.data(), _originalWidth, _originalHeight, 0,
-            finalImageData.data(), _width, _height, 0,
-            STBIR_RGBA
-        );
+        const uint32 mipWidth = MAX(1u, width >> level);
+        const uint32 mipHeight = MAX(1u, height >> level);
+
+        dataSize += format != BlockFormat::None ?
+            TextureCompressor::GetLevelSize(format, mipWidth, mipHeight) :
+            static_cast<size_t>(mipWidth) * mipHeight * 4;
     }
-    else
+
+    return dataSize;
+}
+
+bool Texture::LoadDdsData(const void* data, size_t dataSize) noexcept
+{
+    DdsImage image = {};
+
+    if (!DdsFile::Parse(data, dataSize, image))
     {
-        finalImageData = _originalImageData;
+        return false;
     }
 
-    D3D11_TEXTURE2D_DESC textureDesc = {};
-    textureDesc.Width = _width;
-    textureDesc.Height = _height;
-    textureDesc.MipLevels = 1;
-    textureDesc.ArraySize = 1;
-    textureDesc.Format = _format;
-    textureDesc.SampleDesc.Count = 1;
-    textureDesc.SampleDesc.Quality = 0;
-    textureDesc.Usage = D3D11_USAGE_DEFAULT;
-    textureDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
-    textureDesc.CPUAccessFlags = 0;
-    textureDesc.MiscFlags = 0;
+    if (image._format != BlockFormat::None)
+    {
+        CompressedImage compressedImage = {};
+        compressedImage._data.assign(image._data, image._data + image._dataSize);
+        compressedImage._format = image._format;
+        compressedImage._width = image._width;
+        compressedImage._height = image._height;
+        compressedImage._mipLevels = image._mipLevels;
+
+        SetCompressedImage(std::move(compressedImage));
+
+        return true;
+    }
+
+    const size_t baseSize = static_cast<size_t>(image._width) * image._height * 4;
+
+    _originalImageData.assign(image._data, image._data + baseSize);
+    _mipChainData.assign(image._data + baseSize, image._data + image._dataSize);
+    _originalWidth = image._width;
+    _originalHeight = image._height;
+    _mipLevels = image._mipLevels;
 
-    D3D11_SUBRESOURCE_DATA initData = {};
-    initData.pSysMem = finalImageData.data();
-    initData.SysMemPitch = _width * 4;
-    initData.SysMemSlicePitch = 0;
+    if (image._isBgra)
+    {
+        for (size_t i = 0; i < _originalImageData.size(); i += 4)
+        {
+            std::swap(_originalImageData[i], _originalImageData[i + 2]);
+        }
 
-    _texture2D.Reset();
-    _shaderResourceView.Reset();
+        for (size_t i = 0; i < _mipChainData.size(); i += 4)
+        {
+            std::swap(_mipChainData[i], _mipChainData[i + 2]);
+        }
+    }
 
-    ASSERT_HR(_device->CreateTexture2D(&textureDesc, &initData, &_texture2D));
+    return true;
+}
 
-    finalImageData.clear();
+void Texture::SetImageData(std::vector<unsigned char>&& imageData, uint32 width, uint32 height) noexcept
+{
+    assert(imageData.size() == static_cast<size_t>(width) * height * 4);
 
-    return CreateShaderResourceView();
+    _originalImageData = std::move(imageData);
+    _originalWidth = width;
+    _originalHeight = height;
+    _width = width;
+    _height = height;
+    _mipChainData.clear();
+    _mappedData = nullptr;
+    _mappedSize = 0;
+    _mipLevels = 1;
+    _mipGenerationTime = 0.0f;
 }
 
-bool Texture::CreateShaderResourceView() noexcept
+bool Texture::CreateTexture() noexcept
 {
-    D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-    srvDesc.Format = _format;
-    srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
-    srvDesc.Texture2D.MipLevels = 1;
-    srvDesc.Texture2D.MostDetailedMip = 0;
+    _graphicTexture.reset();
+
+    if (_context == nullptr)
+    {
+        return true;
+    }
 
-    ASSERT_HR(_device->CreateShaderResourceView(_texture2D.Get(), &srvDesc, &_shaderResourceView));
+    _graphicTexture = _context->CreateTexture(*this);
 
-    return true;
+    return _graphicTexture != nullptr;
 }
\ No newline at end of file
@@ -0,0 +1,210 @@
+#include "TextureAtlas.h"
+
+#define STB_RECT_PACK_IMPLEMENTATION
+
+#include "stb_rect_pack.h"
+
+static bool IsSinglePage(std::vector<stbrp_rect> rects, std::vector<stbrp_node>& nodes, uint32 pageSize) noexcept
+{
+	stbrp_context context;
+	stbrp_init_target(&context, static_cast<int>(pageSize), static_cast<int>(pageSize),
+		nodes.data(), static_cast<int>(pageSize));
+
+	return stbrp_pack_rects(&context, rects.data(), static_cast<int>(rects.size())) == 1;
+}
+
+TextureAtlas::TextureAtlas(uint32 pageSize, uint32 padding) noexcept
+	: _maxPageSize(pageSize)
+	, _pageSize(pageSize)
+	, _padding(padding)
+	, _stats()
+{
+	assert(_pageSize > _padding * 2);
+}
+
+bool TextureAtlas::Pack(const std::vector<AtlasImage>& images) noexcept
+{
+	Clear();
+
+	_pageSize = _maxPageSize;
+	_placements.assign(images.size(), { 0, 0, 0, false });
+	_imageSizes.resize(images.size() * 2);
+
+	std::vector<stbrp_rect> pending;
+	pending.reserve(images.size());
+
+	for (size_t i = 0; i < images.size(); ++i)
+	{
+		const AtlasImage& image = images[i];
+
+		_imageSizes[i * 2] = image._width;
+		_imageSizes[i * 2 + 1] = image._height;
+
+		uint32 paddedWidth = image._width + _padding * 2;
+		uint32 paddedHeight = image._height + _padding * 2;
+
+		if (image._width == 0 || image._height == 0 || paddedWidth > _pageSize || paddedHeight > _pageSize)
+		{
+			_stats._rejectedCount++;
+			continue;
+		}
+
+		stbrp_rect rect = {};
+		rect.id = static_cast<int>(i);
+		rect.w = static_cast<stbrp_coord>(paddedWidth);
+		rect.h = static_cast<stbrp_coord>(paddedHeight);
+		pending.push_back(rect);
+	}
+
+	std::vector<stbrp_node> nodes(_maxPageSize);
+
+	// A batch that fits on one page, such as the few textures a frame requests lazily, is packed into
+	// the smallest power-of-two page that holds it instead of a full-size page.
+	uint64 paddedArea = 0;
+	uint32 paddedSize = 0;
+
+	for (const stbrp_rect& rect : pending)
+	{
+		paddedArea += static_cast<uint64>(rect.w) * static_cast<uint64>(rect.h);
+		paddedSize = MAX(paddedSize, static_cast<uint32>(MAX(rect.w, rect.h)));
+	}
+
+	while (!pending.empty() && _pageSize / 2 >= paddedSize &&
+		static_cast<uint64>(_pageSize / 2) * (_pageSize / 2) >= paddedArea)
+	{
+		_pageSize /= 2;
+	}
+
+	while (_pageSize < _maxPageSize && !IsSinglePage(pending, nodes, _pageSize))
+	{
+		_pageSize *= 2;
+	}
+
+	while (!pending.empty())
+	{
+		stbrp_context context;
+		stbrp_init_target(&context, static_cast<int>(_pageSize), static_cast<int>(_pageSize),
+			nodes.data(), static_cast<int>(nodes.size()));
+		stbrp_pack_rects(&context, pending.data(), static_cast<int>(pending.size()));
+
+		const uint32 page = _stats._pageCount;
+		bool anyPacked = false;
+
+		auto it = std::remove_if(pending.begin(), pending.end(),
+			[this, page, &anyPacked](const stbrp_rect& rect)
+			{
+				if (!rect.was_packed)
+				{
+					return false;
+				}
+
+				AtlasPlacement& placement = _placements[rect.id];
+				placement._page = page;
+				placement._x = static_cast<uint32>(rect.x) + _padding;
+				placement._y = static_cast<uint32>(rect.y) + _padding;
+				placement._isPacked = true;
+
+				_stats._packedCount++;
+				_stats._usedArea += static_cast<uint64>(rect.w) * static_cast<uint64>(rect.h);
+				anyPacked = true;
+
+				return true;
+			});
+
+		pending.erase(it, pending.end());
+
+		assert(anyPacked);
+
+		if (!anyPacked)
+		{
+			return false;
+		}
+
+		_stats._pageCount++;
+	}
+
+	_stats._pageArea = static_cast<uint64>(_pageSize) * static_cast<uint64>(_pageSize) * _stats._pageCount;
+	_stats._efficiency = _stats._pageArea > 0 ?
+		static_cast<float>(static_cast<double>(_stats._usedArea) / static_cast<double>(_stats._pageArea)) : 0.0f;
+
+	return true;
+}
+
+bool TextureAtlas::Build(const std::vector<AtlasImage>& images) noexcept
+{
+	if (!Pack(images))
+	{
+		return false;
+	}
+
+	_pages.resize(_stats._pageCount);
+
+	for (std::vector<uint8>& page : _pages)
+	{
+		page.assign(static_cast<size_t>(_pageSize) * _pageSize * 4, 0);
+	}
+
+	for (size_t i = 0; i < images.size(); ++i)
+	{
+		const AtlasPlacement& placement = _placements[i];
+
+		if (placement._isPacked)
+		{
+			Blit(_pages[placement._page], images[i], placement._x, placement._y);
+		}
+	}
+
+	return true;
+}
+
+void TextureAtlas::Clear() noexcept
+{
+	_placements.clear();
+	_imageSizes.clear();
+	_pages.clear();
+	_stats = AtlasStats();
+}
+
+Vector4 TextureAtlas::GetUVRect(size_t imageIndex) const noexcept
+{
+	const AtlasPlacement& placement = _placements[imageIndex];
+	const float pageSize = static_cast<float>(_pageSize);
+
+	return Vector4(
+		static_cast<float>(placement._x) / pageSize,
+		static_cast<float>(placement._y) / pageSize,
+		static_cast<float>(placement._x + _imageSizes[imageIndex * 2]) / pageSize,
+		static_cast<float>(placement._y + _imageSizes[imageIndex * 2 + 1]) / pageSize
+	);
+}
+
+void TextureAtlas::Blit(std::vector<uint8>& page, const AtlasImage& image, uint32 x, uint32 y) const noexcept
+{
+	const size_t pageStride = static_cast<size_t>(_pageSize) * 4;
+	const size_t imageStride = static_cast<size_t>(image._width) * 4;
+
+	for (uint32 row = 0; row < image._height; ++row)
+	{
+		uint8* destination = &page[(y + row) * pageStride + static_cast<size_t>(x) * 4];
+		const uint8* source = image._pixels + row * imageStride;
+
+		memcpy(destination, source, imageStride);
+
+		for (uint32 pad = 1; pad <= _padding; ++pad)
+		{
+			memcpy(destination - pad * 4, source, 4);
+			memcpy(destination + imageStride + (pad - 1) * 4, source + imageStride - 4, 4);
+		}
+	}
+
+	const size_t paddedStride = imageStride + static_cast<size_t>(_padding) * 8;
+
+	for (uint32 pad = 1; pad <= _padding; ++pad)
+	{
+		const uint8* firstRow = &page[y * pageStride + static_cast<size_t>(x - _padding) * 4];
+		const uint8* lastRow = &page[(y + image._height - 1) * pageStride + static_cast<size_t>(x - _padding) * 4];
+
+		memcpy(&page[(y - pad) * pageStride + static_cast<size_t>(x - _padding) * 4], firstRow, paddedStride);
+		memcpy(&page[(y + image._height - 1 + pad) * pageStride + static_cast<size_t>(x - _padding) * 4], lastRow, paddedStride);
+	}
+}
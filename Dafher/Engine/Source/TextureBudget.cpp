@@ -0,0 +1,158 @@
+#include "TextureBudget.h"
+#include "TextureVariantCache.h"
+#include "Platform.h"
+
+void TextureBudget::Register(const TextureRegion* region, const std::string& key) noexcept
+{
+	assert(region != nullptr);
+
+	_keys.emplace(region, key);
+}
+
+void TextureBudget::Track(Texture* texture, TextureRegion* region) noexcept
+{
+	assert(texture != nullptr);
+
+	_textures[texture] = TrackedTexture{ region, _frameIndex };
+
+	if (region != nullptr)
+	{
+		_evictedRegions.erase(region);
+	}
+}
+
+void TextureBudget::Update(uint64 frameIndex, const TextureVariantCache& variantCache,
+	std::vector<Texture*>& candidates) noexcept
+{
+	_frameIndex = frameIndex;
+
+	_stats._trackedCount = static_cast<uint32>(_textures.size());
+	_stats._cpuResidentCount = 0;
+	_stats._cpuBytes = 0;
+	_stats._gpuBytes = 0;
+	_stats._gpuBudget = _gpuBudget;
+
+	std::vector<std::pair<uint64, Texture*>> idleTextures;
+
+	for (auto& [texture, tracked] : _textures)
+	{
+		const uint64 lastUsedFrame = MAX(texture->GetLastUsedFrame(), tracked._trackFrame);
+
+		if (_isCpuDiscardEnabled && texture->GetCpuMemorySize() > 0 && texture->HasDeviceResources() &&
+			_frameIndex - tracked._trackFrame >= DISCARD_DELAY_FRAMES && !variantCache.HasVariants(texture))
+		{
+			_stats._discardedCount++;
+			_stats._discardedBytes += texture->GetCpuMemorySize();
+
+			texture->ReleaseImageData();
+		}
+
+		if (texture->GetCpuMemorySize() > 0)
+		{
+			_stats._cpuResidentCount++;
+			_stats._cpuBytes += texture->GetCpuMemorySize();
+		}
+
+		_stats._gpuBytes += texture->GetGpuMemorySize();
+
+		if (tracked._region != nullptr && _frameIndex - lastUsedFrame >= EVICTION_DELAY_FRAMES)
+		{
+			idleTextures.emplace_back(lastUsedFrame, texture);
+		}
+	}
+
+	if (_stats._gpuBytes <= _gpuBudget)
+	{
+		return;
+	}
+
+	std::sort(idleTextures.begin(), idleTextures.end(),
+		[](const std::pair<uint64, Texture*>& lhs, const std::pair<uint64, Texture*>& rhs)
+		{
+			return lhs.first < rhs.first;
+		});
+
+	for (const auto& idleTexture : idleTextures)
+	{
+		candidates.push_back(idleTexture.second);
+	}
+}
+
+TextureRegion* TextureBudget::Evict(Texture* texture) noexcept
+{
+	auto it = _textures.find(texture);
+	assert(it != _textures.end() && it->second._region != nullptr);
+
+	TextureRegion* region = it->second._region;
+	const uint64 lastUsedFrame = MAX(texture->GetLastUsedFrame(), it->second._trackFrame);
+	const uint64 gpuBytes = texture->GetGpuMemorySize();
+
+	_stats._trackedCount--;
+	_stats._cpuBytes -= texture->GetCpuMemorySize();
+	_stats._gpuBytes -= gpuBytes;
+	_stats._evictedCount++;
+	_stats._evictedBytes += gpuBytes;
+
+	if (texture->GetCpuMemorySize() > 0)
+	{
+		_stats._cpuResidentCount--;
+	}
+
+	_textures.erase(it);
+	_evictedRegions.insert(region);
+
+	TextureEviction eviction;
+	eviction._key = _keys.at(region);
+	eviction._gpuBytes = gpuBytes;
+	eviction._frameIndex = _frameIndex;
+	eviction._idleFrames = _frameIndex - lastUsedFrame;
+
+	std::string evictionMsg = "Evicted: " + eviction._key + " " + std::to_string(gpuBytes / 1024) + " KB, idle " +
+		std::to_string(eviction._idleFrames) + " frames\n";
+	Platform::DebugOutput(evictionMsg);
+
+	if (_evictionLog.size() >= MAX_EVICTION_LOG)
+	{
+		_evictionLog.pop_front();
+	}
+
+	_evictionLog.push_back(std::move(eviction));
+
+	return region;
+}
+
+const std::string* TextureBudget::Restore(const TextureRegion* region) noexcept
+{
+	if (_evictedRegions.erase(region) == 0)
+	{
+		return nullptr;
+	}
+
+	_stats._restreamedCount++;
+
+	return &_keys.at(region);
+}
+
+const std::string* TextureBudget::FindKey(const Texture* texture) const noexcept
+{
+	auto it = _textures.find(const_cast<Texture*>(texture));
+
+	if (it == _textures.end() || it->second._region == nullptr)
+	{
+		return nullptr;
+	}
+
+	auto keyIt = _keys.find(it->second._region);
+
+	return keyIt != _keys.end() ? &keyIt->second : nullptr;
+}
+
+void TextureBudget::Clear() noexcept
+{
+	_textures.clear();
+	_keys.clear();
+	_evictedRegions.clear();
+	_evictionLog.clear();
+	_frameIndex = 0;
+	_stats = TextureMemoryStats();
+}
@@ -0,0 +1,339 @@
+#include "TextureCompressor.h"
+#include "ThreadPool.h"
+
+#define STB_DXT_IMPLEMENTATION
+#include "stb_dxt.h"
+
+struct BlockCacheHeader
+{
+	uint32 _magic;
+	uint32 _version;
+	uint64 _contentHash;
+	BlockFormat _format;
+	uint32 _width;
+	uint32 _height;
+	uint32 _mipLevels;
+	uint64 _dataSize;
+	float _psnr;
+	uint32 _reserved;
+};
+
+struct BlockRow
+{
+	const uint8* _source;
+	uint8* _target;
+	uint32 _width;
+	uint32 _height;
+	uint32 _row;
+};
+
+static inline void DecodeColor565(uint16 color, uint8* rgb) noexcept
+{
+	const uint32 r = (color >> 11) & 0x1F;
+	const uint32 g = (color >> 5) & 0x3F;
+	const uint32 b = color & 0x1F;
+
+	rgb[0] = static_cast<uint8>((r << 3) | (r >> 2));
+	rgb[1] = static_cast<uint8>((g << 2) | (g >> 4));
+	rgb[2] = static_cast<uint8>((b << 3) | (b >> 2));
+}
+
+bool TextureCompressor::Compress(const uint8* imageData, const uint8* mipChainData, uint32 width, uint32 height,
+	uint32 mipLevels, ThreadPool* threadPool, CompressedImage& image) noexcept
+{
+	assert(imageData != nullptr);
+	assert(mipLevels == 1 || mipChainData != nullptr);
+
+	image._format = HasAlpha(imageData, static_cast<size_t>(width) * height) ? BlockFormat::BC3 : BlockFormat::BC1;
+	image._width = width;
+	image._height = height;
+	image._mipLevels = mipLevels;
+
+	size_t dataSize = 0;
+
+	for (uint32 level = 0; level < mipLevels; ++level)
+	{
+		dataSize += GetLevelSize(image._format, MAX(1u, width >> level), MAX(1u, height >> level));
+	}
+
+	image._data.resize(dataSize);
+
+	std::vector<BlockRow> rows;
+	const uint8* source = imageData;
+	uint8* target = image._data.data();
+
+	for (uint32 level = 0; level < mipLevels; ++level)
+	{
+		const uint32 levelWidth = MAX(1u, width >> level);
+		const uint32 levelHeight = MAX(1u, height >> level);
+		const uint32 blockRowCount = (levelHeight + 3) / 4;
+
+		for (uint32 row = 0; row < blockRowCount; ++row)
+		{
+			rows.push_back({ source, target, levelWidth, levelHeight, row });
+		}
+
+		source = level == 0 ? mipChainData : source + static_cast<size_t>(levelWidth) * levelHeight * 4;
+		target += GetLevelSize(image._format, levelWidth, levelHeight);
+	}
+
+	const BlockFormat format = image._format;
+	const uint32 blockSize = GetBlockSize(format);
+
+	auto encodeRow = [&rows, format, blockSize](uint32 index)
+	{
+		const BlockRow& row = rows[index];
+		const uint32 blockCount = (row._width + 3) / 4;
+		uint8 pixels[16 * 4];
+
+		for (uint32 blockX = 0; blockX < blockCount; ++blockX)
+		{
+			for (uint32 y = 0; y < 4; ++y)
+			{
+				const uint32 sourceY = MIN(row._row * 4 + y, row._height - 1);
+
+				for (uint32 x = 0; x < 4; ++x)
+				{
+					const uint32 sourceX = MIN(blockX * 4 + x, row._width - 1);
+					memcpy(&pixels[(y * 4 + x) * 4], &row._source[(static_cast<size_t>(sourceY) * row._width + sourceX) * 4], 4);
+				}
+			}
+
+			uint8* block = row._target + (static_cast<size_t>(row._row) * blockCount + blockX) * blockSize;
+			stb_compress_dxt_block(block, pixels, format == BlockFormat::BC3 ? 1 : 0, STB_DXT_HIGHQUAL);
+		}
+	};
+
+	if (threadPool != nullptr)
+	{
+		threadPool->ParallelFor(static_cast<uint32>(rows.size()), encodeRow);
+	}
+	else
+	{
+		for (uint32 i = 0; i < static_cast<uint32>(rows.size()); ++i)
+		{
+			encodeRow(i);
+		}
+	}
+
+	image._psnr = CalculatePsnr(imageData, width, height, image);
+
+	return true;
+}
+
+bool TextureCompressor::LoadCache(const std::filesystem::path& cachePath, uint64 contentHash, CompressedImage& image) noexcept
+{
+	std::ifstream file(cachePath, std::ios::binary);
+
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	BlockCacheHeader header = {};
+
+	if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+		header._magic != CACHE_MAGIC || header._version != CACHE_VERSION || header._contentHash != contentHash)
+	{
+		return false;
+	}
+
+	image._data.resize(static_cast<size_t>(header._dataSize));
+
+	if (!file.read(reinterpret_cast<char*>(image._data.data()), static_cast<std::streamsize>(header._dataSize)))
+	{
+		return false;
+	}
+
+	image._format = header._format;
+	image._width = header._width;
+	image._height = header._height;
+	image._mipLevels = header._mipLevels;
+	image._psnr = header._psnr;
+
+	return true;
+}
+
+bool TextureCompressor::SaveCache(const std::filesystem::path& cachePath, uint64 contentHash, const CompressedImage& image) noexcept
+{
+	std::error_code errorCode;
+	std::filesystem::create_directories(cachePath.parent_path(), errorCode);
+
+	std::ofstream file(cachePath, std::ios::binary | std::ios::trunc);
+
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	BlockCacheHeader header = {};
+	header._magic = CACHE_MAGIC;
+	header._version = CACHE_VERSION;
+	header._contentHash = contentHash;
+	header._format = image._format;
+	header._width = image._width;
+	header._height = image._height;
+	header._mipLevels = image._mipLevels;
+	header._dataSize = image._data.size();
+	header._psnr = image._psnr;
+
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	file.write(reinterpret_cast<const char*>(image._data.data()), static_cast<std::streamsize>(image._data.size()));
+
+	return file.good();
+}
+
+std::filesystem::path TextureCompressor::GetCachePath(const std::filesystem::path& cacheFolder, uint64 contentHash) noexcept
+{
+	char fileName[32];
+	snprintf(fileName, sizeof(fileName), "%016llx.bc", static_cast<unsigned long long>(contentHash));
+
+	return cacheFolder / fileName;
+}
+
+float TextureCompressor::CalculatePsnr(const uint8* imageData, uint32 width, uint32 height, const CompressedImage& image) noexcept
+{
+	const uint32 blockCountX = (width + 3) / 4;
+	const uint32 blockCountY = (height + 3) / 4;
+	const uint32 blockSize = GetBlockSize(image._format);
+	const uint32 channelCount = image._format == BlockFormat::BC3 ? 4 : 3;
+
+	double squaredError = 0.0;
+	uint8 pixels[16 * 4];
+
+	for (uint32 blockY = 0; blockY < blockCountY; ++blockY)
+	{
+		for (uint32 blockX = 0; blockX < blockCountX; ++blockX)
+		{
+			DecodeBlock(image._format, &image._data[(static_cast<size_t>(blockY) * blockCountX + blockX) * blockSize], pixels);
+
+			for (uint32 y = 0; y < 4 && blockY * 4 + y < height; ++y)
+			{
+				for (uint32 x = 0; x < 4 && blockX * 4 + x < width; ++x)
+				{
+					const uint8* original = &imageData[((static_cast<size_t>(blockY) * 4 + y) * width + blockX * 4 + x) * 4];
+					const uint8* decoded = &pixels[(y * 4 + x) * 4];
+
+					for (uint32 c = 0; c < channelCount; ++c)
+					{
+						const double difference = static_cast<double>(original[c]) - decoded[c];
+						squaredError += difference * difference;
+					}
+				}
+			}
+		}
+	}
+
+	const double meanSquaredError = squaredError / (static_cast<double>(width) * height * channelCount);
+
+	if (meanSquaredError <= 0.0)
+	{
+		return MAX_PSNR;
+	}
+
+	return MIN(MAX_PSNR, static_cast<float>(10.0 * std::log10(255.0 * 255.0 / meanSquaredError)));
+}
+
+bool TextureCompressor::HasAlpha(const uint8* imageData, size_t pixelCount) noexcept
+{
+	for (size_t i = 0; i < pixelCount; ++i)
+	{
+		if (imageData[i * 4 + 3] != 255)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+size_t TextureCompressor::GetLevelSize(BlockFormat format, uint32 width, uint32 height) noexcept
+{
+	return static_cast<size_t>((width + 3) / 4) * ((height + 3) / 4) * GetBlockSize(format);
+}
+
+void TextureCompressor::DecodeBlock(BlockFormat format, const uint8* block, uint8* pixels) noexcept
+{
+	if (format == BlockFormat::BC3)
+	{
+		uint8 alphas[8];
+		alphas[0] = block[0];
+		alphas[1] = block[1];
+
+		if (alphas[0] > alphas[1])
+		{
+			for (uint32 i = 1; i < 7; ++i)
+			{
+				alphas[i + 1] = static_cast<uint8>(((7 - i) * alphas[0] + i * alphas[1]) / 7);
+			}
+		}
+		else
+		{
+			for (uint32 i = 1; i < 5; ++i)
+			{
+				alphas[i + 1] = static_cast<uint8>(((5 - i) * alphas[0] + i * alphas[1]) / 5);
+			}
+
+			alphas[6] = 0;
+			alphas[7] = 255;
+		}
+
+		uint64 alphaBits = 0;
+
+		for (uint32 i = 0; i < 6; ++i)
+		{
+			alphaBits |= static_cast<uint64>(block[2 + i]) << (8 * i);
+		}
+
+		for (uint32 i = 0; i < 16; ++i)
+		{
+			pixels[i * 4 + 3] = alphas[(alphaBits >> (3 * i)) & 0x7];
+		}
+
+		block += 8;
+	}
+
+	const uint16 color0 = static_cast<uint16>(block[0] | (block[1] << 8));
+	const uint16 color1 = static_cast<uint16>(block[2] | (block[3] << 8));
+
+	uint8 colors[4][4];
+	DecodeColor565(color0, colors[0]);
+	DecodeColor565(color1, colors[1]);
+	colors[0][3] = 255;
+	colors[1][3] = 255;
+
+	const bool isFourColor = format == BlockFormat::BC3 || color0 > color1;
+
+	for (uint32 c = 0; c < 3; ++c)
+	{
+		if (isFourColor)
+		{
+			colors[2][c] = static_cast<uint8>((2 * colors[0][c] + colors[1][c]) / 3);
+			colors[3][c] = static_cast<uint8>((colors[0][c] + 2 * colors[1][c]) / 3);
+		}
+		else
+		{
+			colors[2][c] = static_cast<uint8>((colors[0][c] + colors[1][c]) / 2);
+			colors[3][c] = 0;
+		}
+	}
+
+	colors[2][3] = 255;
+	colors[3][3] = isFourColor ? 255 : 0;
+
+	const uint32 indices = block[4] | (block[5] << 8) | (block[6] << 16) | (static_cast<uint32>(block[7]) << 24);
+
+	for (uint32 i = 0; i < 16; ++i)
+	{
+		const uint8* color = colors[(indices >> (2 * i)) & 0x3];
+
+		pixels[i * 4 + 0] = color[0];
+		pixels[i * 4 + 1] = color[1];
+		pixels[i * 4 + 2] = color[2];
+
+		if (format != BlockFormat::BC3)
+		{
+			pixels[i * 4 + 3] = color[3];
+		}
+	}
+}
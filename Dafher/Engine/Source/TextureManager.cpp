@@ -1,98 +1,1023 @@
 #include "TextureManager.h"
 #include "Engine.h"
 #include "GraphicDevice.h"
+#include "Renderer.h"
+#include "RenderThread.h"
+#include "Platform.h"
+#include "ThreadPool.h"
+#include "TextureCompressor.h"
 
-bool TextureManager::Init(const ComPtr<ID3D11Device>& device) noexcept
+static inline bool ParseFrameNumber(std::string_view key, std::string_view name, uint32& frameNumber) noexcept
 {
-	_device = device;
+    if (key.size() <= name.size() || key.substr(0, name.size()) != name)
+    {
+        return false;
+    }
+
+    std::string_view digits = key.substr(name.size());
+
+    if (digits[0] == '_')
+    {
+        digits.remove_prefix(1);
+    }
+
+    if (digits.empty() || digits.size() > 9)
+    {
+        return false;
+    }
+
+    frameNumber = 0;
+
+    for (char c : digits)
+    {
+        if (!std::isdigit(static_cast<unsigned char>(c)))
+        {
+            return false;
+        }
+
+        frameNumber = frameNumber * 10 + static_cast<uint32>(c - '0');
+    }
+
+    return true;
+}
+
+bool TextureManager::Init(GraphicContext* context) noexcept
+{
+	_context = context;
+    _loadStats = TextureLoadStats();
+
+    _streamer = std::make_unique<TextureStreamer>(Engine::GetInstance()->GetFileIO());
+
+    std::vector<unsigned char> placeholderData =
+    {
+        160, 160, 160, 255, 96, 96, 96, 255,
+        96, 96, 96, 255, 160, 160, 160, 255
+    };
+
+    auto placeholder = std::make_unique<Texture>();
+    placeholder->CreateFromImageData(_context, std::move(placeholderData), 2, 2);
+    _placeholder = AddTexture(std::move(placeholder));
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
 
-	RecursiveLoad(L"../Resources/");
+    // The Cooker builds and validates the manifest. Hashing every asset here would stall startup, and
+    // without a manifest every key resolves to the placeholder.
+    if (!_manifest.Open(MANIFEST_PATH))
+    {
+        std::string missingMsg = std::string("Manifest: ") + MANIFEST_PATH + " is missing, run the Cooker\n";
+        Platform::DebugOutput(missingMsg);
+    }
+
+    std::chrono::duration<float, std::milli> manifestTime = std::chrono::steady_clock::now() - startTime;
+    _loadStats._manifestTime = manifestTime.count();
+
+    std::string manifestMsg = "Manifest: " + std::to_string(_manifest.GetEntryCount()) + " entries, " +
+        std::to_string(_loadStats._manifestTime) + " ms\n";
+    Platform::DebugOutput(manifestMsg);
+
+    if (_pack.Open(PACK_PATH))
+    {
+        std::string packMsg = "Pack: " + std::to_string(_pack.GetEntryCount()) + " entries\n";
+        Platform::DebugOutput(packMsg);
+    }
 
     return true;
 }
 
 void TextureManager::Clear() noexcept
 {
+    if (_streamer != nullptr)
+    {
+        _streamer->Cancel();
+    }
+
+    _streamResults.clear();
+    _pendingKeys.clear();
+    _evictionCandidates.clear();
+    _evictedVariants.clear();
+    _retiredTextures.clear();
+    _placeholder = nullptr;
+    _variantCache.Clear();
+    _budget.Clear();
+    _freeTextureIds.clear();
+    _nextTextureId = 1;
+
+    for (uint32 i = 0; i < static_cast<uint32>(_slots.size()); ++i)
+    {
+        if (_slots[i]._region != nullptr)
+        {
+            _slots[i] = TextureSlot{ nullptr, std::string_view(), _slots[i]._generation + 1 };
+            _freeSlots.push_back(i);
+        }
+    }
+
+    _slotIndices.clear();
+    _regions.clear();
+    _flipbooks.clear();
+    _virtualTextures.clear();
     _textures.clear();
+    _manifest.Close();
+    _pack.Close();
+    _atlasStats = AtlasStats();
+    _loadStats = TextureLoadStats();
+}
+
+const TextureRegion* TextureManager::GetTexture(const std::string& key) noexcept
+{
+    auto it = _regions.find(key);
+    if (it != _regions.end())
+    {
+        return &it->second;
+    }
+
+    const AssetManifestEntry* entry = _manifest.Find(key);
+
+    if (entry == nullptr)
+    {
+        return AddMissingRegion(key);
+    }
+
+    // The region keeps the placeholder until LoadPending decodes every key queued since the last
+    // batch across the thread pool, at scene initialization and before each frame's update and draw.
+    TextureRegion region = {};
+    region._texture = _placeholder;
+    region._uvRect = Vector4(0.0f, 0.0f, 1.0f, 1.0f);
+    region._width = entry->_width;
+    region._height = entry->_height;
+    region._isAtlased = false;
+    region._isResident = false;
+
+    TextureRegion* pendingRegion = &_regions.emplace(key, region).first->second;
+    _budget.Register(pendingRegion, key);
+    _pendingKeys.push_back(key);
+
+    return pendingRegion;
+}
+
+TextureHandle TextureManager::GetHandle(const TextureKey& key) noexcept
+{
+    TextureHandle handle = FindHandle(key);
+
+    if (handle.IsValid())
+    {
+        return handle;
+    }
+
+    const std::string name(key._name);
+    const TextureRegion* region = GetTexture(name);
+
+    return region != nullptr ? AddHandle(name, region) : TextureHandle{};
+}
+
+TextureHandle TextureManager::RequestHandle(const TextureKey& key, StreamPriority priority) noexcept
+{
+    TextureHandle handle = FindHandle(key);
+
+    if (handle.IsValid())
+    {
+        if (!_slots[handle._index]._region->_isResident)
+        {
+            RequestTexture(std::string(key._name), priority);
+        }
+
+        return handle;
+    }
+
+    const std::string name(key._name);
+    const TextureRegion* region = RequestTexture(name, priority);
+
+    return region != nullptr ? AddHandle(name, region) : TextureHandle{};
 }
 
-void TextureManager::RecursiveLoad(const std::wstring& folderPath) noexcept
+TextureHandle TextureManager::FindHandle(const TextureKey& key) const noexcept
 {
-    std::wstring searchPath = folderPath + L"*.*";
+    auto it = _slotIndices.find(key._hash);
+
+    if (it == _slotIndices.end())
+    {
+        return TextureHandle{};
+    }
+
+    const TextureSlot& slot = _slots[it->second];
+    assert(slot._key == key._name);
+
+    return slot._key == key._name ? TextureHandle{ it->second, slot._generation } : TextureHandle{};
+}
 
-    WIN32_FIND_DATAW findData;
-    HANDLE hFind = FindFirstFileW(searchPath.c_str(), &findData);
+TextureHandle TextureManager::AddHandle(const std::string& key, const TextureRegion* region) noexcept
+{
+    auto regionIt = _regions.find(key);
+    assert(regionIt != _regions.end() && &regionIt->second == region);
 
-	assert(hFind != INVALID_HANDLE_VALUE);
+    uint32 index = 0;
 
-    do
+    if (!_freeSlots.empty())
+    {
+        index = _freeSlots.back();
+        _freeSlots.pop_back();
+    }
+    else
     {
-        std::wstring fileName = std::wstring(findData.cFileName);
+        index = static_cast<uint32>(_slots.size());
+        _slots.push_back(TextureSlot{ nullptr, std::string_view(), 1 });
+    }
+
+    TextureSlot& slot = _slots[index];
+    slot._region = region;
+    slot._key = regionIt->first;
+
+    _slotIndices[TextureKey::Hash(slot._key)] = index;
 
-        if (fileName == L"." || fileName == L"..")
+    return TextureHandle{ index, slot._generation };
+}
+
+const TextureRegion* TextureManager::RequestTexture(const std::string& key, StreamPriority priority) noexcept
+{
+    auto it = _regions.find(key);
+    if (it != _regions.end())
+    {
+        if (!it->second._isResident)
+        {
+            StreamTexture(&it->second, key, *_manifest.Find(key), priority);
+        }
+
+        return &it->second;
+    }
+
+    const AssetManifestEntry* entry = _manifest.Find(key);
+
+    if (entry == nullptr)
+    {
+        return AddMissingRegion(key);
+    }
+
+    TextureRegion region = {};
+    region._texture = _placeholder;
+    region._uvRect = Vector4(0.0f, 0.0f, 1.0f, 1.0f);
+    region._width = entry->_width;
+    region._height = entry->_height;
+    region._isAtlased = false;
+    region._isResident = false;
+
+    TextureRegion* placeholderRegion = &_regions.emplace(key, region).first->second;
+    _budget.Register(placeholderRegion, key);
+    StreamTexture(placeholderRegion, key, *entry, priority);
+
+    return placeholderRegion;
+}
+
+void TextureManager::StreamTexture(TextureRegion* region, const std::string& key,
+    const AssetManifestEntry& entry, StreamPriority priority) noexcept
+{
+    if (_streamer->IsPending(region))
+    {
+        _streamer->Request(region, _manifest.GetFilePath(entry), priority);
+        return;
+    }
+
+    auto texture = std::make_unique<Texture>();
+
+    if (LoadFromPack(texture.get(), key, entry._contentHash))
+    {
+        _streamer->Submit(region, std::move(texture), priority);
+    }
+    else
+    {
+        _streamer->Request(region, _manifest.GetFilePath(entry), priority);
+    }
+}
+
+void TextureManager::Update() noexcept
+{
+    LoadPending();
+
+    _variantCache.Update(_evictedVariants);
+    RetireEvictedVariants();
+
+    _streamResults.clear();
+    _streamer->Collect(_streamResults);
+
+    for (StreamResult& result : _streamResults)
+    {
+        TextureRegion* region = result._region;
+        assert(!region->_isResident);
+
+        if (region->_isResident)
         {
             continue;
         }
 
-        std::wstring fullPath = folderPath + fileName;
+        if (result._texture != nullptr)
+        {
+            result._texture->CreateDeviceResources(_context);
+        }
 
-        if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+        _streamer->CompleteUpload(result);
+
+        if (result._texture != nullptr)
         {
-            RecursiveLoad(fullPath + L"/");
+            region->_width = result._texture->GetWidth();
+            region->_height = result._texture->GetHeight();
+            region->_isResident = true;
+            region->_texture = AddTexture(std::move(result._texture));
+
+            _budget.Track(region->_texture, region);
         }
-        else if (IsImageFile(fileName))
+    }
+
+    UpdateBudget();
+    ReleaseRetiredTextures();
+}
+
+void TextureManager::UpdateBudget() noexcept
+{
+    _evictionCandidates.clear();
+    _budget.Update(Engine::GetInstance()->GetRenderer()->GetFrameIndex(), _variantCache, _evictionCandidates);
+
+    for (Texture* texture : _evictionCandidates)
+    {
+        if (_budget.GetStats()._gpuBytes <= _budget.GetGpuBudget())
         {
-            std::string key = GetFileNameWithoutExtension(fileName);
-            Load(key, fullPath);
+            break;
+        }
+
+        const bool isRemoved = _variantCache.RemoveSource(texture, _evictedVariants);
+        RetireEvictedVariants();
 
-            std::string debugMsg = "Loaded: " + key + "\n";
-            OutputDebugStringA(debugMsg.c_str());
+        if (!isRemoved)
+        {
+            continue;
         }
 
-    } while (FindNextFileW(hFind, &findData));
+        TextureRegion* region = _budget.Evict(texture);
+        region->_texture = _placeholder;
+        region->_isResident = false;
+
+        RemoveTexture(texture);
+    }
+}
+
+bool TextureManager::EnsureResident(const TextureRegion* region, StreamPriority priority) noexcept
+{
+    if (region->_isResident)
+    {
+        return true;
+    }
+
+    const std::string* key = _budget.Restore(region);
+
+    if (key != nullptr)
+    {
+        RequestTexture(*key, priority);
+    }
 
-    FindClose(hFind);
+    return false;
 }
 
-Texture* TextureManager::Load(const std::string& key, const std::wstring& filePath) noexcept
+Texture* TextureManager::AcquireVariant(const Texture* source, uint32 width, uint32 height) noexcept
 {
-    auto it = _textures.find(key);
-    if (it != _textures.end())
+    if (!source->HasImageData() && !RestoreImageData(source))
+    {
+        return nullptr;
+    }
+
+    Texture* variant = _variantCache.Acquire(_context, source, width, height, Engine::GetInstance()->GetThreadPool());
+
+    if (variant->GetId() == 0)
+    {
+        variant->SetId(AllocateTextureId());
+    }
+
+    return variant;
+}
+
+void TextureManager::ReleaseVariant(const Texture* variant) noexcept
+{
+    _variantCache.Release(variant);
+}
+
+void TextureManager::Preload(const std::vector<std::string>& keys) noexcept
+{
+    _pendingKeys.insert(_pendingKeys.end(), keys.begin(), keys.end());
+
+    LoadPending();
+}
+
+void TextureManager::LoadPending() noexcept
+{
+    if (_pendingKeys.empty())
+    {
+        return;
+    }
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    std::vector<TextureSource> sources;
+    sources.reserve(_pendingKeys.size());
+
+    for (const std::string& key : _pendingKeys)
+    {
+        const AssetManifestEntry* entry = _manifest.Find(key);
+
+        if (entry != nullptr)
+        {
+            sources.push_back({ key, _manifest.GetFilePath(*entry), entry->_contentHash });
+        }
+        else if (_regions.find(key) == _regions.end())
+        {
+            AddMissingRegion(key);
+        }
+    }
+
+    _pendingKeys.clear();
+    LoadAll(sources);
+
+    std::chrono::duration<float, std::milli> totalTime = std::chrono::steady_clock::now() - startTime;
+    _loadStats._totalTime += totalTime.count();
+
+    std::string statsMsg = "Textures: " + std::to_string(_loadStats._imageCount) + " images on " +
+        std::to_string(_loadStats._threadCount) + " threads, manifest " +
+        std::to_string(_loadStats._manifestTime) + " ms, decode " +
+        std::to_string(_loadStats._decodeTime) + " ms, atlas " +
+        std::to_string(_loadStats._atlasTime) + " ms, mips " +
+        std::to_string(_loadStats._mipTime) + " ms (+" +
+        std::to_string(_loadStats._mipMemory / 1024) + " KB over " +
+        std::to_string(_loadStats._baseMemory / 1024) + " KB), upload " +
+        std::to_string(_loadStats._uploadTime) + " ms, total " +
+        std::to_string(_loadStats._totalTime) + " ms\n" +
+        "Sources: pack " + std::to_string(_loadStats._packImageCount) + " images in " +
+        std::to_string(_loadStats._packLoadTime) + " ms, loose " +
+        std::to_string(_loadStats._looseImageCount) + " images in " +
+        std::to_string(_loadStats._looseLoadTime) + " ms\n";
+    Platform::DebugOutput(statsMsg);
+}
+
+VirtualTexture* TextureManager::GetVirtualTexture(const std::string& key) noexcept
+{
+    auto it = _virtualTextures.find(key);
+    if (it != _virtualTextures.end())
     {
         return it->second.get();
     }
 
-	auto texture = std::make_unique<Texture>();
-    bool enabled = texture->LoadFromFile(_device, filePath);
-    assert(enabled);
-    
+    std::unique_ptr<VirtualTexture> virtualTexture = std::make_unique<VirtualTexture>();
+
+    if (!virtualTexture->Open(_context, std::filesystem::path(VIRTUAL_TEXTURE_PATH) / (key + VirtualTextureFile::EXTENSION)))
+    {
+        assert(false);
+        return nullptr;
+    }
+
+    Texture* physicalTexture = virtualTexture->GetPhysicalTexture();
+    physicalTexture->SetId(AllocateTextureId());
+    _budget.Track(physicalTexture, nullptr);
+
+    return _virtualTextures.emplace(key, std::move(virtualTexture)).first->second.get();
+}
+
+const Flipbook* TextureManager::GetFlipbook(const std::string& name) noexcept
+{
+    auto it = _flipbooks.find(name);
+    if (it != _flipbooks.end())
+    {
+        return it->second.get();
+    }
+
+    std::vector<std::pair<uint32, const AssetManifestEntry*>> frameEntries;
+
+    for (uint32 i = 0; i < _manifest.GetEntryCount(); ++i)
+    {
+        const AssetManifestEntry& entry = _manifest.GetEntries()[i];
+        uint32 frameNumber = 0;
+
+        if (ParseFrameNumber(_manifest.GetKey(entry), name, frameNumber))
+        {
+            frameEntries.emplace_back(frameNumber, &entry);
+        }
+    }
+
+    if (frameEntries.empty())
+    {
+        std::string missingMsg = "Missing: flipbook " + name + " has no frames in the manifest\n";
+        Platform::DebugOutput(missingMsg);
+        return nullptr;
+    }
+
+    std::sort(frameEntries.begin(), frameEntries.end(),
+        [](const std::pair<uint32, const AssetManifestEntry*>& lhs, const std::pair<uint32, const AssetManifestEntry*>& rhs)
+        {
+            return lhs.first < rhs.first;
+        });
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    std::vector<std::unique_ptr<Texture>> textures(frameEntries.size());
+
+    Engine::GetInstance()->GetThreadPool()->ParallelFor(static_cast<uint32>(frameEntries.size()),
+        [this, &frameEntries, &textures](uint32 index)
+        {
+            const AssetManifestEntry& entry = *frameEntries[index].second;
+            auto texture = std::make_unique<Texture>();
+
+            if (!LoadFromPack(texture.get(), std::string(_manifest.GetKey(entry)), entry._contentHash))
+            {
+                [[maybe_unused]] bool enabled = texture->LoadImageFromFile(_manifest.GetFilePath(entry));
+                assert(enabled);
+            }
+
+            textures[index] = std::move(texture);
+        });
+
+    std::vector<size_t> atlasIndices;
+    std::vector<AtlasImage> atlasImages;
+
+    for (size_t i = 0; i < textures.size(); ++i)
+    {
+        if (textures[i]->HasImageData())
+        {
+            atlasImages.push_back({ textures[i]->GetPixels(), textures[i]->GetWidth(), textures[i]->GetHeight() });
+            atlasIndices.push_back(i);
+        }
+    }
+
+    TextureAtlas atlas;
+    atlas.Build(atlasImages);
+
+    auto flipbook = std::make_unique<Flipbook>();
+    flipbook->_frames.resize(textures.size());
+    flipbook->_frameWidth = textures[0]->GetWidth();
+    flipbook->_frameHeight = textures[0]->GetHeight();
+    flipbook->_pageCount = atlas.GetPageCount();
+
+    std::vector<Texture*> pages;
+
+    for (std::vector<uint8>& pageData : atlas.GetPages())
+    {
+        auto page = std::make_unique<Texture>();
+        page->CreateFromImageData(_context, std::move(pageData), atlas.GetPageSize(), atlas.GetPageSize());
+        pages.push_back(AddTexture(std::move(page)));
+
+        _budget.Track(pages.back(), nullptr);
+    }
+
+    for (size_t i = 0; i < atlasIndices.size(); ++i)
+    {
+        const AtlasPlacement& placement = atlas.GetPlacements()[i];
+
+        if (placement._isPacked)
+        {
+            flipbook->_frames[atlasIndices[i]] = FlipbookFrame{ pages[placement._page], atlas.GetUVRect(i) };
+            textures[atlasIndices[i]].reset();
+        }
+    }
+
+    for (size_t i = 0; i < textures.size(); ++i)
+    {
+        if (textures[i] == nullptr)
+        {
+            continue;
+        }
+
+        textures[i]->GenerateMips(Engine::GetInstance()->GetThreadPool());
+        textures[i]->CreateDeviceResources(_context);
+
+        Texture* texture = AddTexture(std::move(textures[i]));
+        _budget.Track(texture, nullptr);
+
+        flipbook->_frames[i] = FlipbookFrame{ texture, Vector4(0.0f, 0.0f, 1.0f, 1.0f) };
+        flipbook->_pageCount++;
+    }
+
+    std::chrono::duration<float, std::milli> buildTime = std::chrono::steady_clock::now() - startTime;
+
+    std::string flipbookMsg = "Flipbook: " + name + " " + std::to_string(flipbook->_frames.size()) + " frames in " +
+        std::to_string(flipbook->_pageCount) + " textures, " + std::to_string(buildTime.count()) + " ms\n";
+    Platform::DebugOutput(flipbookMsg);
+
+    return _flipbooks.emplace(name, std::move(flipbook)).first->second.get();
+}
+
+void TextureManager::LoadAll(const std::vector<TextureSource>& sources) noexcept
+{
+    std::vector<const TextureSource*> pendingSources;
+    std::unordered_set<std::string> pendingKeys;
+
+    for (const TextureSource& source : sources)
+    {
+        auto it = _regions.find(source._key);
+        const bool isLoaded = it != _regions.end() && (it->second._isResident || _streamer->IsPending(&it->second));
+
+        if (!isLoaded && pendingKeys.insert(source._key).second)
+        {
+            pendingSources.push_back(&source);
+        }
+    }
+
+    ThreadPool* threadPool = Engine::GetInstance()->GetThreadPool();
+    std::vector<std::unique_ptr<Texture>> textures(pendingSources.size());
+
+    std::chrono::steady_clock::time_point phaseStart = std::chrono::steady_clock::now();
+
+    std::vector<uint8> packHits(pendingSources.size(), 0);
+    std::vector<uint8> cacheHits(pendingSources.size(), 0);
+    std::vector<float> cachedPsnrs(pendingSources.size(), 0.0f);
+    std::vector<float> loadTimes(pendingSources.size(), 0.0f);
+
+    threadPool->ParallelFor(static_cast<uint32>(pendingSources.size()),
+        [this, &pendingSources, &textures, &packHits, &cacheHits, &cachedPsnrs, &loadTimes](uint32 index)
+        {
+            std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+            auto texture = std::make_unique<Texture>();
+
+            if (LoadFromPack(texture.get(), pendingSources[index]->_key, pendingSources[index]->_contentHash))
+            {
+                packHits[index] = 1;
+            }
+            else if (LoadCompressed(texture.get(), pendingSources[index]->_contentHash, cachedPsnrs[index]))
+            {
+                cacheHits[index] = 1;
+            }
+            else
+            {
+                [[maybe_unused]] bool enabled = texture->LoadImageFromFile(pendingSources[index]->_filePath);
+                assert(enabled);
+            }
+
+            textures[index] = std::move(texture);
+
+            std::chrono::duration<float, std::milli> loadTime = std::chrono::steady_clock::now() - startTime;
+            loadTimes[index] = loadTime.count();
+        });
+
+    for (size_t i = 0; i < pendingSources.size(); ++i)
+    {
+        if (packHits[i])
+        {
+            ++_loadStats._packImageCount;
+            _loadStats._packLoadTime += loadTimes[i];
+        }
+        else
+        {
+            ++_loadStats._looseImageCount;
+            _loadStats._looseLoadTime += loadTimes[i];
+        }
+    }
+
+    std::chrono::duration<float, std::milli> decodeTime = std::chrono::steady_clock::now() - phaseStart;
+    phaseStart = std::chrono::steady_clock::now();
+
+    std::vector<size_t> atlasIndices;
+    std::vector<AtlasImage> atlasImages;
+
+    for (size_t i = 0; i < textures.size(); ++i)
+    {
+        const Texture* texture = textures[i].get();
+
+        if (texture->HasImageData() &&
+            texture->GetWidth() <= MAX_ATLAS_IMAGE_SIZE && texture->GetHeight() <= MAX_ATLAS_IMAGE_SIZE)
+        {
+            atlasImages.push_back({ texture->GetPixels(), texture->GetWidth(), texture->GetHeight() });
+            atlasIndices.push_back(i);
+        }
+    }
+
+    TextureAtlas atlas;
+    atlas.Build(atlasImages);
+
+    std::chrono::duration<float, std::milli> atlasTime = std::chrono::steady_clock::now() - phaseStart;
+    phaseStart = std::chrono::steady_clock::now();
+
+    std::vector<Texture*> pages;
+
+    for (std::vector<uint8>& pageData : atlas.GetPages())
+    {
+        auto page = std::make_unique<Texture>();
+        page->CreateFromImageData(_context, std::move(pageData), atlas.GetPageSize(), atlas.GetPageSize());
+        pages.push_back(AddTexture(std::move(page)));
+
+        _budget.Track(pages.back(), nullptr);
+    }
+
+    for (size_t i = 0; i < atlasIndices.size(); ++i)
+    {
+        const AtlasPlacement& placement = atlas.GetPlacements()[i];
+
+        if (!placement._isPacked)
+        {
+            continue;
+        }
+
+        TextureRegion& region = _regions[pendingSources[atlasIndices[i]]->_key];
+        region._texture = pages[placement._page];
+        region._uvRect = atlas.GetUVRect(i);
+        region._width = atlasImages[i]._width;
+        region._height = atlasImages[i]._height;
+        region._isAtlased = true;
+        region._isResident = true;
+
+        textures[atlasIndices[i]].reset();
+    }
+
+    std::chrono::duration<float, std::milli> pageTime = std::chrono::steady_clock::now() - phaseStart;
+    phaseStart = std::chrono::steady_clock::now();
+
+    threadPool->ParallelFor(static_cast<uint32>(textures.size()),
+        [&textures](uint32 index)
+        {
+            if (textures[index] != nullptr && !textures[index]->IsCompressed())
+            {
+                textures[index]->GenerateMips();
+            }
+        });
+
+    std::chrono::duration<float, std::milli> mipTime = std::chrono::steady_clock::now() - phaseStart;
+
+    for (size_t i = 0; i < textures.size(); ++i)
+    {
+        if (textures[i] == nullptr)
+        {
+            continue;
+        }
+
+        if (cacheHits[i])
+        {
+            AddCompressionResult(pendingSources[i]->_key, textures[i].get(), cachedPsnrs[i], true);
+        }
+        else if (!packHits[i])
+        {
+            CompressTexture(pendingSources[i]->_key, textures[i].get(), pendingSources[i]->_contentHash);
+        }
+    }
+
+    phaseStart = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < textures.size(); ++i)
+    {
+        if (textures[i] != nullptr)
+        {
+            textures[i]->CreateDeviceResources(_context);
+            AddRegion(pendingSources[i]->_key, AddTexture(std::move(textures[i])));
+        }
+    }
+
+    std::chrono::duration<float, std::milli> uploadTime = std::chrono::steady_clock::now() - phaseStart;
+
+    const AtlasStats& atlasStats = atlas.GetStats();
+    _atlasStats._pageCount += atlasStats._pageCount;
+    _atlasStats._packedCount += atlasStats._packedCount;
+    _atlasStats._rejectedCount += atlasStats._rejectedCount;
+    _atlasStats._usedArea += atlasStats._usedArea;
+    _atlasStats._pageArea += atlasStats._pageArea;
+    _atlasStats._efficiency = _atlasStats._pageArea > 0 ?
+        static_cast<float>(static_cast<double>(_atlasStats._usedArea) / static_cast<double>(_atlasStats._pageArea)) : 0.0f;
+
+    _loadStats._imageCount += static_cast<uint32>(pendingSources.size());
+    _loadStats._threadCount = threadPool->GetThreadCount();
+    _loadStats._decodeTime += decodeTime.count();
+    _loadStats._atlasTime += atlasTime.count();
+    _loadStats._mipTime += mipTime.count();
+    _loadStats._uploadTime += pageTime.count() + uploadTime.count();
+
+    std::string atlasMsg = "Atlas: " + std::to_string(_atlasStats._packedCount) + " images in " +
+        std::to_string(_atlasStats._pageCount) + " pages, " +
+        std::to_string(static_cast<int32>(_atlasStats._efficiency * 100.0f)) + "% used\n";
+    Platform::DebugOutput(atlasMsg);
+}
+
+bool TextureManager::LoadFromPack(Texture* texture, const std::string& key, uint64 contentHash) const noexcept
+{
+    if (!_isPackEnabled)
+    {
+        return false;
+    }
+
+    const AssetPackEntry* entry = _pack.Find(key);
+
+    if (entry == nullptr || entry->_contentHash != contentHash)
+    {
+        return false;
+    }
+
+    return texture->SetMappedImage(_pack.GetData(*entry), entry->_dataSize, entry->_format,
+        entry->_width, entry->_height, entry->_mipLevels);
+}
+
+bool TextureManager::RestoreImageData(const Texture* texture) noexcept
+{
+    // The budget discards CPU copies once a texture is uploaded, so a later resize decodes the
+    // source again; the copy is kept from then on while the texture has variants.
+    const std::string* key = _budget.FindKey(texture);
+    const AssetManifestEntry* entry = key != nullptr ? _manifest.Find(*key) : nullptr;
+
+    auto it = std::find_if(_textures.begin(), _textures.end(),
+        [texture](const std::unique_ptr<Texture>& ownedTexture)
+        {
+            return ownedTexture.get() == texture;
+        });
+
+    if (entry == nullptr || it == _textures.end() || texture->IsCompressed())
+    {
+        return false;
+    }
+
+    Texture* ownedTexture = it->get();
+
+    if (!LoadFromPack(ownedTexture, *key, entry->_contentHash) && !ownedTexture->LoadImageFromFile(_manifest.GetFilePath(*entry)))
+    {
+        return false;
+    }
+
+    std::string restoreMsg = "Restored: " + *key + " " + std::to_string(ownedTexture->GetCpuMemorySize() / 1024) + " KB for resizing\n";
+    Platform::DebugOutput(restoreMsg);
+
+    return ownedTexture->HasImageData();
+}
+
+bool TextureManager::LoadCompressed(Texture* texture, uint64 contentHash, float& psnr) noexcept
+{
+    if (!_isCompressionEnabled || contentHash == 0)
+    {
+        return false;
+    }
+
+    CompressedImage image = {};
+
+    if (!TextureCompressor::LoadCache(TextureCompressor::GetCachePath(COMPRESSION_CACHE_PATH, contentHash), contentHash, image))
+    {
+        return false;
+    }
+
+    psnr = image._psnr;
+    texture->SetCompressedImage(std::move(image));
+
+    return true;
+}
+
+bool TextureManager::CompressTexture(const std::string& key, Texture* texture, uint64 contentHash) noexcept
+{
+    if (!_isCompressionEnabled || texture->IsCompressed() ||
+        texture->GetWidth() % 4 != 0 || texture->GetHeight() % 4 != 0)
+    {
+        return false;
+    }
+
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    CompressedImage image = {};
+    TextureCompressor::Compress(texture->GetPixels(), texture->GetMipPixels(),
+        texture->GetWidth(), texture->GetHeight(), texture->GetMipLevels(), Engine::GetInstance()->GetThreadPool(), image);
+
+    if (contentHash != 0)
+    {
+        TextureCompressor::SaveCache(TextureCompressor::GetCachePath(COMPRESSION_CACHE_PATH, contentHash), contentHash, image);
+    }
+
+    std::chrono::duration<float, std::milli> encodeTime = std::chrono::steady_clock::now() - startTime;
+    _compressionStats._encodeTime += encodeTime.count();
+
+    const float psnr = image._psnr;
+    texture->SetCompressedImage(std::move(image));
+    AddCompressionResult(key, texture, psnr, false);
+
+    return true;
+}
+
+void TextureManager::AddCompressionResult(const std::string& key, const Texture* texture, float psnr, bool isCached) noexcept
+{
+    uint64 sourceBytes = 0;
+
+    for (uint32 level = 0; level < texture->GetMipLevels(); ++level)
+    {
+        sourceBytes += static_cast<uint64>(MAX(1u, texture->GetWidth() >> level)) * MAX(1u, texture->GetHeight() >> level) * 4;
+    }
+
+    const uint64 compressedBytes = texture->GetMemorySize();
+
+    _compressionStats._textureCount++;
+    _compressionStats._sourceBytes += sourceBytes;
+    _compressionStats._compressedBytes += compressedBytes;
+
+    _compressionStats._averagePsnr += (psnr - _compressionStats._averagePsnr) / static_cast<float>(_compressionStats._textureCount);
+
+    if (isCached)
+    {
+        _compressionStats._cacheHitCount++;
+    }
+
+    std::string compressionMsg = "Compressed: " + key +
+        (texture->GetBlockFormat() == BlockFormat::BC1 ? " BC1 " : " BC3 ") +
+        std::to_string(sourceBytes / 1024) + " KB -> " + std::to_string(compressedBytes / 1024) + " KB (" +
+        std::to_string(static_cast<float>(sourceBytes) / static_cast<float>(compressedBytes)) + "x), " +
+        "PSNR " + std::to_string(psnr) + " dB" + (isCached ? " (cached)\n" : "\n");
+    Platform::DebugOutput(compressionMsg);
+}
+
+Texture* TextureManager::AddTexture(std::unique_ptr<Texture> texture) noexcept
+{
+    _loadStats._baseMemory += texture->GetImageSize();
+    _loadStats._mipMemory += texture->GetMipChainSize();
+
+    texture->SetId(AllocateTextureId());
+
     Texture* ret = texture.get();
-    _textures[key] = std::move(texture);
+    _textures.push_back(std::move(texture));
     return ret;
 }
 
-bool TextureManager::IsImageFile(const std::wstring& fileName) noexcept
+const TextureRegion* TextureManager::AddRegion(const std::string& key, Texture* texture) noexcept
 {
-    size_t dotPos = fileName.find_last_of(L'.');
+    TextureRegion* ret = &_regions[key];
+    ret->_texture = texture;
+    ret->_uvRect = Vector4(0.0f, 0.0f, 1.0f, 1.0f);
+    ret->_width = texture->GetWidth();
+    ret->_height = texture->GetHeight();
+    ret->_isAtlased = false;
+    ret->_isResident = true;
 
-    std::wstring ext = fileName.substr(dotPos);
-    std::transform(ext.begin(), ext.end(), ext.begin(), ::towlower);
+    _budget.Register(ret, key);
+    _budget.Track(texture, ret);
 
-    return ext == L".png" || ext == L".jpg" || ext == L".jpeg" ||
-        ext == L".bmp" || ext == L".tga" || ext == L".dds";
+    return ret;
 }
 
-std::string TextureManager::GetFileNameWithoutExtension(const std::wstring& fileName) noexcept
+const TextureRegion* TextureManager::AddMissingRegion(const std::string& key) noexcept
 {
-    size_t dotPos = fileName.find_last_of(L'.');
-    std::wstring nameWithoutExt = fileName.substr(0, dotPos);
+    // A key the manifest does not know, such as an asset added after the last cook, draws the
+    // placeholder. The region counts as resident so it is neither streamed nor evicted.
+    TextureRegion* ret = &_regions[key];
+    ret->_texture = _placeholder;
+    ret->_uvRect = Vector4(0.0f, 0.0f, 1.0f, 1.0f);
+    ret->_width = _placeholder->GetWidth();
+    ret->_height = _placeholder->GetHeight();
+    ret->_isAtlased = false;
+    ret->_isResident = true;
+
+    std::string missingMsg = "Missing: " + key + " is not in the manifest\n";
+    Platform::DebugOutput(missingMsg);
+
+    return ret;
+}
+
+void TextureManager::RemoveTexture(const Texture* texture) noexcept
+{
+    auto it = std::find_if(_textures.begin(), _textures.end(),
+        [texture](const std::unique_ptr<Texture>& ownedTexture)
+        {
+            return ownedTexture.get() == texture;
+        });
+    assert(it != _textures.end());
 
-    int size = WideCharToMultiByte(CP_UTF8, 0, 
-        nameWithoutExt.c_str(), -1, nullptr, 0, nullptr, nullptr);
+    RetireTexture(std::move(*it));
 
-    std::string result(size - 1, 0);
-    WideCharToMultiByte(CP_UTF8, 0, nameWithoutExt.c_str(),
-        -1, &result[0], size, nullptr, nullptr);
+    std::swap(*it, _textures.back());
+    _textures.pop_back();
+}
+
+void TextureManager::RetireTexture(std::unique_ptr<Texture> texture) noexcept
+{
+    // The last published snapshot may still reference the texture on the render thread, so it is
+    // destroyed and its id recycled only once that frame has been rendered.
+    const uint64 fenceFrame = Engine::GetInstance()->GetRenderThread()->GetPublishedFrameCount();
+    _retiredTextures.push_back(RetiredTexture{ std::move(texture), fenceFrame });
+}
+
+void TextureManager::RetireEvictedVariants() noexcept
+{
+    for (std::unique_ptr<Texture>& variant : _evictedVariants)
+    {
+        RetireTexture(std::move(variant));
+    }
+
+    _evictedVariants.clear();
+}
+
+void TextureManager::ReleaseRetiredTextures() noexcept
+{
+    const uint64 renderedFrameCount = Engine::GetInstance()->GetRenderThread()->GetRenderedFrameCount();
+
+    for (size_t i = 0; i < _retiredTextures.size();)
+    {
+        if (_retiredTextures[i]._fenceFrame > renderedFrameCount)
+        {
+            ++i;
+            continue;
+        }
+
+        _freeTextureIds.push_back(_retiredTextures[i]._texture->GetId());
+
+        std::swap(_retiredTextures[i], _retiredTextures.back());
+        _retiredTextures.pop_back();
+    }
+}
+
+uint32 TextureManager::AllocateTextureId() noexcept
+{
+    if (!_freeTextureIds.empty())
+    {
+        uint32 id = _freeTextureIds.back();
+        _freeTextureIds.pop_back();
+        return id;
+    }
 
-    return result;
+    return _nextTextureId++;
 }
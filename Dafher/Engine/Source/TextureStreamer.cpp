@@ -0,0 +1,234 @@
+#include "TextureStreamer.h"
+
+static inline IoPriority ToIoPriority(StreamPriority priority) noexcept
+{
+	return static_cast<IoPriority>(priority);
+}
+
+TextureStreamer::TextureStreamer(FileIO* fileIO) noexcept
+	: _fileIO(fileIO)
+	, _queuedCount(0)
+	, _jobCount(0)
+	, _decodingCount(0)
+	, _uploadBudget(DEFAULT_UPLOAD_BUDGET)
+	, _latencySampleCount(0)
+	, _stats()
+{
+	assert(_fileIO != nullptr);
+}
+
+TextureStreamer::~TextureStreamer() noexcept
+{
+	Cancel();
+}
+
+void TextureStreamer::Request(TextureRegion* region, const std::filesystem::path& filePath, StreamPriority priority) noexcept
+{
+	assert(region != nullptr);
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	auto it = _pendingRegions.find(region);
+
+	if (it != _pendingRegions.end())
+	{
+		if (it->second._priority == StreamPriority::Count || priority >= it->second._priority)
+		{
+			return;
+		}
+
+		if (_fileIO->SetPriority(it->second._requestId, ToIoPriority(priority)))
+		{
+			it->second._priority = priority;
+		}
+
+		return;
+	}
+
+	const std::chrono::steady_clock::time_point requestTime = std::chrono::steady_clock::now();
+
+	PendingStream& pending = _pendingRegions.emplace(region, PendingStream{ priority, 0 }).first->second;
+	_queuedCount++;
+	_jobCount++;
+
+	pending._requestId = _fileIO->Submit({ filePath,
+		[this, region, requestTime](IoStatus status, IoBuffer& buffer) { Decode(region, requestTime, status, buffer); },
+		ToIoPriority(priority), IoMode::Auto });
+}
+
+void TextureStreamer::Submit(TextureRegion* region, std::unique_ptr<Texture> texture, StreamPriority priority) noexcept
+{
+	assert(region != nullptr);
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	if (_pendingRegions.find(region) != _pendingRegions.end())
+	{
+		return;
+	}
+
+	_pendingRegions.emplace(region, PendingStream{ StreamPriority::Count, 0 });
+	_readyResults.push_back({ region, std::move(texture), std::chrono::steady_clock::now(), priority });
+}
+
+void TextureStreamer::Collect(std::vector<StreamResult>& results) noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_stats._uploadCount = 0;
+	_stats._uploadBytes = 0;
+
+	std::stable_sort(_readyResults.begin(), _readyResults.end(),
+		[](const StreamResult& lhs, const StreamResult& rhs)
+		{
+			return lhs._priority < rhs._priority;
+		});
+
+	size_t index = 0;
+
+	for (; index < _readyResults.size(); ++index)
+	{
+		const Texture* texture = _readyResults[index]._texture.get();
+		const uint64 bytes = texture != nullptr ? texture->GetMemorySize() : 0;
+
+		if (_stats._uploadBytes + bytes > _uploadBudget)
+		{
+			if (_stats._uploadCount > 0)
+			{
+				break;
+			}
+
+			_stats._budgetOverrunCount++;
+			_stats._budgetOverrunBytes += _stats._uploadBytes + bytes - _uploadBudget;
+		}
+
+		auto it = _pendingRegions.find(_readyResults[index]._region);
+
+		if (it != _pendingRegions.end() && it->second._priority == StreamPriority::Count)
+		{
+			_pendingRegions.erase(it);
+		}
+
+		_stats._uploadCount++;
+		_stats._uploadBytes += bytes;
+		results.push_back(std::move(_readyResults[index]));
+	}
+
+	_readyResults.erase(_readyResults.begin(), _readyResults.begin() + index);
+}
+
+void TextureStreamer::CompleteUpload(const StreamResult& result) noexcept
+{
+	std::chrono::duration<float, std::milli> latency = std::chrono::steady_clock::now() - result._requestTime;
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	if (result._texture != nullptr)
+	{
+		_stats._completedCount++;
+	}
+	else
+	{
+		_stats._failedCount++;
+	}
+
+	_latencySampleCount++;
+	_stats._lastLatency = latency.count();
+	_stats._averageLatency += (_stats._lastLatency - _stats._averageLatency) / static_cast<float>(_latencySampleCount);
+	_stats._maxLatency = MAX(_stats._maxLatency, _stats._lastLatency);
+}
+
+void TextureStreamer::Cancel() noexcept
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	for (const auto& [region, pending] : _pendingRegions)
+	{
+		if (pending._priority != StreamPriority::Count)
+		{
+			_fileIO->Cancel(pending._requestId);
+		}
+	}
+
+	_pendingRegions.clear();
+	_queuedCount = 0;
+
+	_idleCondition.wait(lock, [this]() { return _jobCount == 0; });
+
+	_readyResults.clear();
+}
+
+bool TextureStreamer::IsPending(const TextureRegion* region) const noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	return _pendingRegions.find(region) != _pendingRegions.end();
+}
+
+StreamingStats TextureStreamer::GetStats() const noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	StreamingStats stats = _stats;
+	stats._queueDepth = _queuedCount;
+	stats._decodingCount = _decodingCount;
+	stats._readyCount = static_cast<uint32>(_readyResults.size());
+	stats._uploadBudget = _uploadBudget;
+
+	return stats;
+}
+
+void TextureStreamer::Decode(TextureRegion* region, std::chrono::steady_clock::time_point requestTime,
+	IoStatus status, IoBuffer& buffer) noexcept
+{
+	StreamPriority priority = StreamPriority::Count;
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		auto it = _pendingRegions.find(region);
+
+		if (it != _pendingRegions.end() && it->second._priority != StreamPriority::Count)
+		{
+			_queuedCount--;
+
+			if (status == IoStatus::Cancelled)
+			{
+				_pendingRegions.erase(it);
+			}
+			else
+			{
+				priority = it->second._priority;
+				it->second._priority = StreamPriority::Count;
+				_decodingCount++;
+			}
+		}
+	}
+
+	if (priority != StreamPriority::Count)
+	{
+		auto texture = std::make_unique<Texture>();
+
+		if (status != IoStatus::Completed ||
+			!texture->LoadImageFromMemory(buffer.GetData(), static_cast<size_t>(buffer.GetSize())) || !texture->GenerateMips())
+		{
+			texture.reset();
+		}
+
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		_decodingCount--;
+
+		if (_pendingRegions.find(region) != _pendingRegions.end())
+		{
+			_readyResults.push_back({ region, std::move(texture), requestTime, priority });
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	if (--_jobCount == 0)
+	{
+		_idleCondition.notify_all();
+	}
+}
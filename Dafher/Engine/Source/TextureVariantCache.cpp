@@ -0,0 +1,163 @@
+#include "TextureVariantCache.h"
+
+Texture* TextureVariantCache::Acquire(GraphicContext* context, const Texture* source, uint32 width, uint32 height,
+	ThreadPool* threadPool) noexcept
+{
+	assert(source != nullptr);
+
+	const VariantKey key = { source, width, height };
+	auto it = _entries.find(key);
+
+	if (it != _entries.end())
+	{
+		VariantEntry& entry = it->second;
+
+		if (entry._refCount++ == 0)
+		{
+			_stats._unusedCount--;
+			_stats._unusedBytes -= entry._texture->GetMemorySize();
+		}
+
+		_stats._hitCount++;
+
+		return entry._texture.get();
+	}
+
+	auto texture = std::make_unique<Texture>();
+	[[maybe_unused]] bool enabled = texture->CreateResized(context, *source, width, height, threadPool);
+	assert(enabled);
+
+	Texture* variant = texture.get();
+	_entries.emplace(key, VariantEntry{ std::move(texture), 1, 0 });
+	_keys.emplace(variant, key);
+	_sourceCounts[source]++;
+
+	_stats._missCount++;
+	_stats._variantCount++;
+	_stats._memoryBytes += variant->GetMemorySize();
+
+	return variant;
+}
+
+void TextureVariantCache::Release(const Texture* variant) noexcept
+{
+	auto keyIt = _keys.find(variant);
+	assert(keyIt != _keys.end());
+
+	if (keyIt == _keys.end())
+	{
+		return;
+	}
+
+	VariantEntry& entry = _entries.at(keyIt->second);
+	assert(entry._refCount > 0);
+
+	if (--entry._refCount == 0)
+	{
+		entry._releaseFrame = _frameIndex;
+
+		_stats._unusedCount++;
+		_stats._unusedBytes += variant->GetMemorySize();
+	}
+}
+
+void TextureVariantCache::Update(std::vector<std::unique_ptr<Texture>>& evictedTextures) noexcept
+{
+	_frameIndex++;
+
+	if (_stats._unusedBytes <= _maxUnusedBytes)
+	{
+		return;
+	}
+
+	std::vector<std::pair<uint64, VariantKey>> candidates;
+
+	for (const auto& [key, entry] : _entries)
+	{
+		if (entry._refCount == 0 && _frameIndex - entry._releaseFrame >= EVICTION_DELAY_FRAMES)
+		{
+			candidates.emplace_back(entry._releaseFrame, key);
+		}
+	}
+
+	std::sort(candidates.begin(), candidates.end(),
+		[](const std::pair<uint64, VariantKey>& lhs, const std::pair<uint64, VariantKey>& rhs)
+		{
+			return lhs.first < rhs.first;
+		});
+
+	for (const auto& candidate : candidates)
+	{
+		if (_stats._unusedBytes <= _maxUnusedBytes)
+		{
+			break;
+		}
+
+		Erase(candidate.second, evictedTextures);
+	}
+}
+
+bool TextureVariantCache::RemoveSource(const Texture* source, std::vector<std::unique_ptr<Texture>>& evictedTextures) noexcept
+{
+	if (!HasVariants(source))
+	{
+		return true;
+	}
+
+	std::vector<VariantKey> keys;
+
+	for (const auto& [key, entry] : _entries)
+	{
+		if (key._source != source)
+		{
+			continue;
+		}
+
+		if (entry._refCount > 0 || _frameIndex - entry._releaseFrame < EVICTION_DELAY_FRAMES)
+		{
+			return false;
+		}
+
+		keys.push_back(key);
+	}
+
+	for (const VariantKey& key : keys)
+	{
+		Erase(key, evictedTextures);
+	}
+
+	return true;
+}
+
+void TextureVariantCache::Erase(const VariantKey& key, std::vector<std::unique_ptr<Texture>>& evictedTextures) noexcept
+{
+	auto it = _entries.find(key);
+	const Texture* variant = it->second._texture.get();
+	const uint64 bytes = variant->GetMemorySize();
+
+	auto countIt = _sourceCounts.find(key._source);
+
+	if (--countIt->second == 0)
+	{
+		_sourceCounts.erase(countIt);
+	}
+
+	_keys.erase(variant);
+	evictedTextures.push_back(std::move(it->second._texture));
+	_entries.erase(it);
+
+	_stats._variantCount--;
+	_stats._unusedCount--;
+	_stats._evictedCount++;
+	_stats._memoryBytes -= bytes;
+	_stats._unusedBytes -= bytes;
+}
+
+void TextureVariantCache::Clear() noexcept
+{
+	_entries.clear();
+	_keys.clear();
+	_sourceCounts.clear();
+	_frameIndex = 0;
+	_stats = VariantCacheStats();
+}
@@ -0,0 +1,147 @@
+#include "ThreadPool.h"
+
+ThreadPool::ThreadPool(uint32 threadCount) noexcept
+	: _activeCount(0)
+	, _isStopping(false)
+{
+	if (threadCount == 0)
+	{
+		threadCount = MAX(1u, std::thread::hardware_concurrency());
+	}
+
+	_threads.reserve(threadCount);
+
+	for (uint32 i = 0; i < threadCount; ++i)
+	{
+		_threads.emplace_back(&ThreadPool::Run, this);
+	}
+}
+
+ThreadPool::~ThreadPool() noexcept
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_isStopping = true;
+	}
+
+	_taskCondition.notify_all();
+
+	for (std::thread& thread : _threads)
+	{
+		thread.join();
+	}
+}
+
+void ThreadPool::Enqueue(std::function<void()> task) noexcept
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_tasks.push_back(std::move(task));
+	}
+
+	_taskCondition.notify_one();
+}
+
+void ThreadPool::ParallelFor(uint32 count, const std::function<void(uint32)>& function) noexcept
+{
+	if (count == 0)
+	{
+		return;
+	}
+
+	struct ParallelForState
+	{
+		std::atomic<uint32> _nextIndex;
+		std::mutex _mutex;
+		std::condition_variable _condition;
+		uint32 _runningCount;
+		bool _isClosed;
+	};
+
+	auto state = std::make_shared<ParallelForState>();
+	state->_nextIndex = 0;
+	state->_runningCount = 0;
+	state->_isClosed = false;
+
+	auto work = [&function, count](ParallelForState& state)
+	{
+		for (uint32 index = state._nextIndex.fetch_add(1); index < count; index = state._nextIndex.fetch_add(1))
+		{
+			function(index);
+		}
+	};
+
+	const uint32 helperCount = MIN(GetThreadCount(), count - 1);
+
+	for (uint32 i = 0; i < helperCount; ++i)
+	{
+		Enqueue([state, work]()
+		{
+			{
+				std::lock_guard<std::mutex> lock(state->_mutex);
+
+				if (state->_isClosed)
+				{
+					return;
+				}
+
+				state->_runningCount++;
+			}
+
+			work(*state);
+
+			std::lock_guard<std::mutex> lock(state->_mutex);
+
+			if (--state->_runningCount == 0)
+			{
+				state->_condition.notify_all();
+			}
+		});
+	}
+
+	work(*state);
+
+	std::unique_lock<std::mutex> lock(state->_mutex);
+	state->_isClosed = true;
+	state->_condition.wait(lock, [&state]() { return state->_runningCount == 0; });
+}
+
+void ThreadPool::Wait() noexcept
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	_idleCondition.wait(lock, [this]() { return _tasks.empty() && _activeCount == 0; });
+}
+
+void ThreadPool::Run() noexcept
+{
+	while (true)
+	{
+		std::function<void()> task;
+
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_taskCondition.wait(lock, [this]() { return _isStopping || !_tasks.empty(); });
+
+			if (_tasks.empty())
+			{
+				return;
+			}
+
+			task = std::move(_tasks.front());
+			_tasks.pop_front();
+			_activeCount++;
+		}
+
+		task();
+
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_activeCount--;
+
+			if (_tasks.empty() && _activeCount == 0)
+			{
+				_idleCondition.notify_all();
+			}
+		}
+	}
+}
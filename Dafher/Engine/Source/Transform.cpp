@@ -427,6 +427,7 @@ Vector3 Transform::GetWorldUp() const noexcept
 void Transform::MarkWorldMatrixDirty() noexcept
 {
     _isWorldDirty = true;
+    _worldVersion++;
 
     for (const auto& child : _owner->GetChildren())
     {
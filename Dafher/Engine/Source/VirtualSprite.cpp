@@ -0,0 +1,173 @@
+#include "VirtualSprite.h"
+#include "Engine.h"
+#include "TextureManager.h"
+#include "Renderer.h"
+#include "Camera.h"
+#include "Node.h"
+
+VirtualSprite::VirtualSprite(const std::string& textureKey) noexcept
+	: Component()
+	, _virtualTexture(nullptr)
+	, _color(Vector4::One)
+	, _size(Vector2::Zero)
+	, _anchorPoint(Vector2(0.5f, 0.5f))
+	, _layer(0)
+	, _blendMode(BlendMode::Alpha)
+	, _cachedWorldVersion(0)
+	, _isWorldDirty(true)
+{
+	_virtualTexture = Engine::GetInstance()->GetTextureManager()->GetVirtualTexture(textureKey);
+
+	if (_virtualTexture != nullptr)
+	{
+		_size.x = static_cast<float>(_virtualTexture->GetFile().GetWidth());
+		_size.y = static_cast<float>(_virtualTexture->GetFile().GetHeight());
+	}
+}
+
+bool VirtualSprite::Init()
+{
+	return _virtualTexture != nullptr;
+}
+
+void VirtualSprite::PreUpdate(float)
+{
+}
+
+void VirtualSprite::Update(float)
+{
+}
+
+void VirtualSprite::PostUpdate(float)
+{
+	Renderer* renderer = Engine::GetInstance()->GetRenderer();
+	const VirtualTextureFile& file = _virtualTexture->GetFile();
+	Texture* physicalTexture = _virtualTexture->GetPhysicalTexture();
+
+	RefreshWorld();
+	_virtualTexture->BeginFrame(renderer->GetFrameIndex());
+
+	Bounds visibleBounds;
+	uint32 mip = file.GetMipLevels() - 1;
+
+	if (renderer->GetCameras().empty())
+	{
+		const Vector2& screenSize = renderer->GetScreenSize();
+		AddView(renderer->GetDefaultViewBounds(), Vector4(0.0f, 0.0f, screenSize.x, screenSize.y), visibleBounds, mip);
+	}
+	else
+	{
+		for (const Camera* camera : renderer->GetCameras())
+		{
+			if (camera->IsEnabled())
+			{
+				AddView(camera->GetViewBounds(), camera->GetPixelViewport(), visibleBounds, mip);
+			}
+		}
+	}
+
+	const Vector2 extent = _worldBounds._max - _worldBounds._min;
+	Vector4 uvRect;
+
+	if (visibleBounds.IsValid())
+	{
+		uvRect = Vector4(
+			(visibleBounds._min.x - _worldBounds._min.x) / extent.x,
+			(_worldBounds._max.y - visibleBounds._max.y) / extent.y,
+			(visibleBounds._max.x - _worldBounds._min.x) / extent.x,
+			(_worldBounds._max.y - visibleBounds._min.y) / extent.y);
+
+		_virtualTexture->Request(uvRect, mip);
+		_virtualTexture->Update();
+	}
+
+	_virtualTexture->TakeUploads(_uploads);
+
+	for (const VirtualTileUpload& upload : _uploads)
+	{
+		renderer->SubmitUpload(physicalTexture, upload._x, upload._y, file.GetPageSize(), file.GetPageSize(),
+			file.GetTileData(upload._tileIndex));
+	}
+
+	if (!visibleBounds.IsValid())
+	{
+		return;
+	}
+
+	uint32 x0, y0, x1, y1;
+	_virtualTexture->GetTileRange(uvRect, mip, x0, y0, x1, y1);
+
+	for (uint32 y = y0; y <= y1; ++y)
+	{
+		for (uint32 x = x0; x <= x1; ++x)
+		{
+			Vector4 tileUvRect;
+
+			if (!_virtualTexture->Resolve(mip, x, y, tileUvRect))
+			{
+				continue;
+			}
+
+			const Vector4 tileRect = _virtualTexture->GetTileRect(mip, x, y);
+			const Matrix tileScaleMatrix = DirectX::XMMatrixScaling(tileRect.z - tileRect.x, tileRect.w - tileRect.y, 1.0f);
+			const Matrix tileOffsetMatrix = DirectX::XMMatrixTranslation(tileRect.x, 1.0f - tileRect.w, 0.0f);
+			const Matrix tileMatrix = tileScaleMatrix * tileOffsetMatrix * _worldMatrix;
+
+			renderer->Submit(physicalTexture, tileMatrix, tileUvRect, _color, _layer, _blendMode);
+		}
+	}
+}
+
+bool VirtualSprite::GetWorldBounds(Bounds& bounds) const
+{
+	if (_virtualTexture == nullptr || _owner == nullptr)
+	{
+		return false;
+	}
+
+	RefreshWorld();
+	bounds = _worldBounds;
+
+	return true;
+}
+
+void VirtualSprite::RefreshWorld() const noexcept
+{
+	const Transform* transform = _owner->_transform;
+	const uint32 worldVersion = transform->GetWorldVersion();
+
+	if (!_isWorldDirty && _cachedWorldVersion == worldVersion)
+	{
+		return;
+	}
+
+	float offsetX = -_size.x * _anchorPoint.x;
+	float offsetY = -_size.y * _anchorPoint.y;
+
+	Matrix spriteScaleMatrix = DirectX::XMMatrixScaling(_size.x, _size.y, 1.0f);
+	Matrix anchorOffsetMatrix = DirectX::XMMatrixTranslation(offsetX, offsetY, 0.0f);
+	_worldMatrix = spriteScaleMatrix * anchorOffsetMatrix * transform->GetWorldMatrix();
+	_worldBounds = Bounds::FromQuad(_worldMatrix);
+
+	_cachedWorldVersion = worldVersion;
+	_isWorldDirty = false;
+}
+
+void VirtualSprite::AddView(const Bounds& viewBounds, const Vector4& viewport, Bounds& visibleBounds, uint32& mip) const noexcept
+{
+	if (!viewBounds.Intersects(_worldBounds) || viewport.z <= 0.0f ||
+		_worldBounds._max.x <= _worldBounds._min.x || _worldBounds._max.y <= _worldBounds._min.y)
+	{
+		return;
+	}
+
+	const float viewWidth = viewBounds._max.x - viewBounds._min.x;
+	const float screenWidth = (_worldBounds._max.x - _worldBounds._min.x) * viewport.z / viewWidth;
+	const float texelsPerPixel = static_cast<float>(_virtualTexture->GetFile().GetWidth()) / screenWidth;
+
+	mip = MIN(mip, _virtualTexture->SelectMip(texelsPerPixel));
+
+	visibleBounds.Merge(Bounds(
+		Vector2(MAX(viewBounds._min.x, _worldBounds._min.x), MAX(viewBounds._min.y, _worldBounds._min.y)),
+		Vector2(MIN(viewBounds._max.x, _worldBounds._max.x), MIN(viewBounds._max.y, _worldBounds._max.y))));
+}
@@ -0,0 +1,323 @@
+#include "VirtualTexture.h"
+#include "Texture.h"
+
+VirtualTexture::VirtualTexture(uint32 slotsPerSide) noexcept
+	: _frameIndex(0)
+	, _slotsPerSide(slotsPerSide)
+	, _stats{}
+{
+	assert(slotsPerSide > 0 && slotsPerSide * slotsPerSide < INVALID_SLOT);
+}
+
+VirtualTexture::~VirtualTexture() noexcept
+{
+	Close();
+}
+
+bool VirtualTexture::Open(GraphicContext* context, const std::filesystem::path& filePath) noexcept
+{
+	Close();
+
+	if (!_file.Open(filePath))
+	{
+		return false;
+	}
+
+	const uint32 physicalSize = _file.GetPageSize() * _slotsPerSide;
+
+	_physicalTexture = std::make_unique<Texture>();
+
+	if (!_physicalTexture->CreateFromImageData(context,
+		std::vector<unsigned char>(static_cast<size_t>(physicalSize) * physicalSize * 4), physicalSize, physicalSize))
+	{
+		Close();
+		return false;
+	}
+
+	if (_physicalTexture->HasDeviceResources())
+	{
+		_physicalTexture->ReleaseImageData();
+	}
+
+	_pageTable.assign(_file.GetTileCount(), INVALID_SLOT);
+	_requestFrames.assign(_file.GetTileCount(), UINT64_MAX);
+	_tileMips.resize(_file.GetTileCount());
+
+	for (uint32 mip = 0; mip < _file.GetMipLevels(); ++mip)
+	{
+		const uint32 first = _file.GetTileIndex(mip, 0, 0);
+		const uint32 count = _file.GetTilesX(mip) * _file.GetTilesY(mip);
+
+		std::fill(_tileMips.begin() + first, _tileMips.begin() + first + count, static_cast<uint8>(mip));
+	}
+
+	const uint32 slotCount = _slotsPerSide * _slotsPerSide;
+	_slots.resize(slotCount);
+	_freeSlots.resize(slotCount);
+
+	for (uint32 i = 0; i < slotCount; ++i)
+	{
+		_slots[i] = { UINT32_MAX, 0, false };
+		_freeSlots[i] = slotCount - 1 - i;
+	}
+
+	_stats._slotCount = slotCount;
+
+	return LoadTile(_file.GetTileIndex(_file.GetMipLevels() - 1, 0, 0), true);
+}
+
+void VirtualTexture::Close() noexcept
+{
+	_file.Close();
+	_physicalTexture.reset();
+	_pageTable.clear();
+	_tileMips.clear();
+	_slots.clear();
+	_freeSlots.clear();
+	_requestFrames.clear();
+	_requests.clear();
+	_uploads.clear();
+	_frameIndex = 0;
+	_stats = {};
+}
+
+void VirtualTexture::BeginFrame(uint64 frameIndex) noexcept
+{
+	if (frameIndex == _frameIndex)
+	{
+		return;
+	}
+
+	_frameIndex = frameIndex;
+	_requests.clear();
+
+	_stats._requestedCount = 0;
+	_stats._missingCount = 0;
+	_stats._fallbackCount = 0;
+	_stats._uploadedCount = 0;
+	_stats._evictedCount = 0;
+	_stats._uploadedBytes = 0;
+}
+
+uint32 VirtualTexture::SelectMip(float texelsPerPixel) const noexcept
+{
+	if (!(texelsPerPixel > 1.0f))
+	{
+		return 0;
+	}
+
+	const uint32 mip = static_cast<uint32>(std::floor(std::log2(texelsPerPixel)));
+
+	return MIN(mip, _file.GetMipLevels() - 1);
+}
+
+void VirtualTexture::Request(const Vector4& uvRect, uint32 mip) noexcept
+{
+	assert(_file.IsOpen());
+
+	mip = MIN(mip, _file.GetMipLevels() - 1);
+
+	uint32 x0, y0, x1, y1;
+	GetTileRange(uvRect, mip, x0, y0, x1, y1);
+
+	for (uint32 y = y0; y <= y1; ++y)
+	{
+		for (uint32 x = x0; x <= x1; ++x)
+		{
+			const uint32 tileIndex = _file.GetTileIndex(mip, x, y);
+
+			if (_requestFrames[tileIndex] != _frameIndex)
+			{
+				_requestFrames[tileIndex] = _frameIndex;
+				_requests.push_back(tileIndex);
+				_stats._requestedCount++;
+			}
+		}
+	}
+}
+
+void VirtualTexture::Update(uint32 maxUploads) noexcept
+{
+	std::vector<uint32> missing;
+
+	for (uint32 tileIndex : _requests)
+	{
+		const uint16 slot = _pageTable[tileIndex];
+
+		if (slot != INVALID_SLOT)
+		{
+			_slots[slot]._lastUsedFrame = _frameIndex;
+		}
+		else
+		{
+			missing.push_back(tileIndex);
+		}
+	}
+
+	_stats._missingCount = static_cast<uint32>(missing.size());
+
+	std::stable_sort(missing.begin(), missing.end(), [this](uint32 lhs, uint32 rhs)
+		{
+			return _tileMips[lhs] > _tileMips[rhs];
+		});
+
+	for (uint32 i = 0; i < missing.size() && i < maxUploads; ++i)
+	{
+		if (!LoadTile(missing[i], false))
+		{
+			break;
+		}
+	}
+
+	_requests.clear();
+}
+
+bool VirtualTexture::Resolve(uint32 mip, uint32 tileX, uint32 tileY, Vector4& uvRect) noexcept
+{
+	assert(_file.IsOpen());
+
+	const Vector4 tileRect = GetTileRect(mip, tileX, tileY);
+	const float s0 = tileRect.x;
+	const float t0 = tileRect.y;
+	const float s1 = tileRect.z;
+	const float t1 = tileRect.w;
+	const uint32 tileSize = _file.GetTileSize();
+
+	for (uint32 level = mip; level < _file.GetMipLevels(); ++level)
+	{
+		const float levelWidth = static_cast<float>(_file.GetMipWidth(level));
+		const float levelHeight = static_cast<float>(_file.GetMipHeight(level));
+		const uint32 levelX = MIN(static_cast<uint32>((s0 + s1) * 0.5f * levelWidth) / tileSize, _file.GetTilesX(level) - 1);
+		const uint32 levelY = MIN(static_cast<uint32>((t0 + t1) * 0.5f * levelHeight) / tileSize, _file.GetTilesY(level) - 1);
+		const uint16 slot = _pageTable[_file.GetTileIndex(level, levelX, levelY)];
+
+		if (slot == INVALID_SLOT)
+		{
+			continue;
+		}
+
+		_slots[slot]._lastUsedFrame = _frameIndex;
+
+		if (level != mip)
+		{
+			_stats._fallbackCount++;
+		}
+
+		const float originX = static_cast<float>(levelX * tileSize);
+		const float originY = static_cast<float>(levelY * tileSize);
+		const float maxX = MIN(static_cast<float>(tileSize), levelWidth - originX);
+		const float maxY = MIN(static_cast<float>(tileSize), levelHeight - originY);
+
+		const float pageX = static_cast<float>((slot % _slotsPerSide) * _file.GetPageSize() + _file.GetBorder());
+		const float pageY = static_cast<float>((slot / _slotsPerSide) * _file.GetPageSize() + _file.GetBorder());
+		const float physicalSize = static_cast<float>(_file.GetPageSize() * _slotsPerSide);
+
+		uvRect.x = (pageX + std::clamp(s0 * levelWidth - originX, 0.0f, maxX)) / physicalSize;
+		uvRect.y = (pageY + std::clamp(t0 * levelHeight - originY, 0.0f, maxY)) / physicalSize;
+		uvRect.z = (pageX + std::clamp(s1 * levelWidth - originX, 0.0f, maxX)) / physicalSize;
+		uvRect.w = (pageY + std::clamp(t1 * levelHeight - originY, 0.0f, maxY)) / physicalSize;
+
+		return true;
+	}
+
+	return false;
+}
+
+bool VirtualTexture::IsResident(uint32 mip, uint32 tileX, uint32 tileY) const noexcept
+{
+	return _pageTable[_file.GetTileIndex(mip, tileX, tileY)] != INVALID_SLOT;
+}
+
+void VirtualTexture::GetTileRange(const Vector4& uvRect, uint32 mip,
+	uint32& x0, uint32& y0, uint32& x1, uint32& y1) const noexcept
+{
+	const float tileSize = static_cast<float>(_file.GetTileSize());
+	const float mipWidth = static_cast<float>(_file.GetMipWidth(mip));
+	const float mipHeight = static_cast<float>(_file.GetMipHeight(mip));
+	const int32 maxX = static_cast<int32>(_file.GetTilesX(mip)) - 1;
+	const int32 maxY = static_cast<int32>(_file.GetTilesY(mip)) - 1;
+
+	x0 = static_cast<uint32>(std::clamp(static_cast<int32>(std::floor(uvRect.x * mipWidth / tileSize)), 0, maxX));
+	y0 = static_cast<uint32>(std::clamp(static_cast<int32>(std::floor(uvRect.y * mipHeight / tileSize)), 0, maxY));
+	x1 = static_cast<uint32>(std::clamp(static_cast<int32>(std::ceil(uvRect.z * mipWidth / tileSize)) - 1,
+		static_cast<int32>(x0), maxX));
+	y1 = static_cast<uint32>(std::clamp(static_cast<int32>(std::ceil(uvRect.w * mipHeight / tileSize)) - 1,
+		static_cast<int32>(y0), maxY));
+}
+
+Vector4 VirtualTexture::GetTileRect(uint32 mip, uint32 tileX, uint32 tileY) const noexcept
+{
+	const uint32 tileSize = _file.GetTileSize();
+	const float mipWidth = static_cast<float>(_file.GetMipWidth(mip));
+	const float mipHeight = static_cast<float>(_file.GetMipHeight(mip));
+
+	return Vector4(
+		static_cast<float>(tileX * tileSize) / mipWidth,
+		static_cast<float>(tileY * tileSize) / mipHeight,
+		MIN(static_cast<float>((tileX + 1) * tileSize), mipWidth) / mipWidth,
+		MIN(static_cast<float>((tileY + 1) * tileSize), mipHeight) / mipHeight);
+}
+
+void VirtualTexture::TakeUploads(std::vector<VirtualTileUpload>& uploads) noexcept
+{
+	uploads.clear();
+	uploads.swap(_uploads);
+}
+
+bool VirtualTexture::LoadTile(uint32 tileIndex, bool isPinned) noexcept
+{
+	const uint32 slot = AllocateSlot();
+
+	if (slot == INVALID_SLOT)
+	{
+		return false;
+	}
+
+	_pageTable[tileIndex] = static_cast<uint16>(slot);
+	_slots[slot] = { tileIndex, _frameIndex, isPinned };
+	_uploads.push_back({ tileIndex, (slot % _slotsPerSide) * _file.GetPageSize(), (slot / _slotsPerSide) * _file.GetPageSize() });
+
+	_stats._residentCount++;
+	_stats._uploadedCount++;
+	_stats._uploadedBytes += _file.GetTileBytes();
+
+	return true;
+}
+
+uint32 VirtualTexture::AllocateSlot() noexcept
+{
+	if (!_freeSlots.empty())
+	{
+		const uint32 slot = _freeSlots.back();
+		_freeSlots.pop_back();
+
+		return slot;
+	}
+
+	uint32 victim = INVALID_SLOT;
+
+	for (uint32 i = 0; i < _slots.size(); ++i)
+	{
+		const TileSlot& slot = _slots[i];
+
+		if (slot._isPinned || slot._lastUsedFrame >= _frameIndex)
+		{
+			continue;
+		}
+
+		if (victim == INVALID_SLOT || slot._lastUsedFrame < _slots[victim]._lastUsedFrame)
+		{
+			victim = i;
+		}
+	}
+
+	if (victim != INVALID_SLOT)
+	{
+		_pageTable[_slots[victim]._tileIndex] = INVALID_SLOT;
+		_slots[victim] = { UINT32_MAX, 0, false };
+		_stats._residentCount--;
+		_stats._evictedCount++;
+	}
+
+	return victim;
+}
@@ -0,0 +1,161 @@
+#include "VirtualTextureFile.h"
+#include "ImageResizer.h"
+#include "Texture.h"
+
+bool VirtualTextureFile::Open(const std::filesystem::path& filePath) noexcept
+{
+	Close();
+
+	if (!_file.Open(filePath) || _file.GetSize() < DATA_OFFSET)
+	{
+		Close();
+		return false;
+	}
+
+	const VirtualTextureHeader* header = reinterpret_cast<const VirtualTextureHeader*>(_file.GetData());
+
+	if (header->_magic != MAGIC || header->_version != VERSION || header->_width == 0 || header->_height == 0 ||
+		header->_tileSize == 0 || header->_mipLevels != CalculateMipLevels(header->_width, header->_height, header->_tileSize))
+	{
+		Close();
+		return false;
+	}
+
+	_header = header;
+	_mipOffsets.resize(header->_mipLevels);
+
+	uint32 tileCount = 0;
+
+	for (uint32 mip = 0; mip < header->_mipLevels; ++mip)
+	{
+		_mipOffsets[mip] = tileCount;
+		tileCount += GetTilesX(mip) * GetTilesY(mip);
+	}
+
+	if (tileCount != header->_tileCount || DATA_OFFSET + tileCount * GetTileBytes() > _file.GetSize())
+	{
+		Close();
+		return false;
+	}
+
+	return true;
+}
+
+void VirtualTextureFile::Close() noexcept
+{
+	_file.Close();
+	_header = nullptr;
+	_mipOffsets.clear();
+}
+
+bool VirtualTextureFile::Build(const std::filesystem::path& sourcePath, const std::filesystem::path& outputPath,
+	uint32 tileSize, uint32 border, ThreadPool* threadPool) noexcept
+{
+	assert(tileSize > 0);
+
+	Texture texture;
+
+	if (!texture.LoadImageFromFile(sourcePath) || !texture.HasImageData())
+	{
+		return false;
+	}
+
+	VirtualTextureHeader header = {};
+	header._magic = MAGIC;
+	header._version = VERSION;
+	header._width = texture.GetWidth();
+	header._height = texture.GetHeight();
+	header._tileSize = tileSize;
+	header._border = border;
+	header._mipLevels = CalculateMipLevels(header._width, header._height, tileSize);
+
+	std::vector<std::vector<uint8>> mips(header._mipLevels);
+	mips[0].assign(texture.GetPixels(), texture.GetPixels() + texture.GetImageSize());
+
+	for (uint32 mip = 1; mip < header._mipLevels; ++mip)
+	{
+		const uint32 sourceWidth = MAX(1u, header._width >> (mip - 1));
+		const uint32 sourceHeight = MAX(1u, header._height >> (mip - 1));
+		const uint32 targetWidth = MAX(1u, header._width >> mip);
+		const uint32 targetHeight = MAX(1u, header._height >> mip);
+
+		mips[mip].resize(static_cast<size_t>(targetWidth) * targetHeight * 4);
+
+		if (!ImageResizer::Resize(mips[mip - 1].data(), sourceWidth, sourceHeight,
+			mips[mip].data(), targetWidth, targetHeight, threadPool))
+		{
+			return false;
+		}
+	}
+
+	for (uint32 mip = 0; mip < header._mipLevels; ++mip)
+	{
+		const uint32 mipWidth = MAX(1u, header._width >> mip);
+		const uint32 mipHeight = MAX(1u, header._height >> mip);
+
+		header._tileCount += ((mipWidth + tileSize - 1) / tileSize) * ((mipHeight + tileSize - 1) / tileSize);
+	}
+
+	std::ofstream file(outputPath, std::ios::binary | std::ios::trunc);
+
+	if (!file.is_open())
+	{
+		return false;
+	}
+
+	static const char padding[DATA_OFFSET] = {};
+
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	file.write(padding, static_cast<std::streamsize>(DATA_OFFSET - sizeof(header)));
+
+	const uint32 pageSize = tileSize + border * 2;
+	std::vector<uint8> page(static_cast<size_t>(pageSize) * pageSize * 4);
+
+	for (uint32 mip = 0; mip < header._mipLevels; ++mip)
+	{
+		const int32 mipWidth = static_cast<int32>(MAX(1u, header._width >> mip));
+		const int32 mipHeight = static_cast<int32>(MAX(1u, header._height >> mip));
+		const uint32 tilesX = (static_cast<uint32>(mipWidth) + tileSize - 1) / tileSize;
+		const uint32 tilesY = (static_cast<uint32>(mipHeight) + tileSize - 1) / tileSize;
+		const uint8* mipData = mips[mip].data();
+
+		for (uint32 tileY = 0; tileY < tilesY; ++tileY)
+		{
+			for (uint32 tileX = 0; tileX < tilesX; ++tileX)
+			{
+				const int32 originX = static_cast<int32>(tileX * tileSize) - static_cast<int32>(border);
+				const int32 originY = static_cast<int32>(tileY * tileSize) - static_cast<int32>(border);
+				uint8* target = page.data();
+
+				for (uint32 y = 0; y < pageSize; ++y)
+				{
+					const int32 sourceY = std::clamp(originY + static_cast<int32>(y), 0, mipHeight - 1);
+					const uint8* sourceRow = mipData + static_cast<size_t>(sourceY) * mipWidth * 4;
+
+					for (uint32 x = 0; x < pageSize; ++x)
+					{
+						const int32 sourceX = std::clamp(originX + static_cast<int32>(x), 0, mipWidth - 1);
+						std::memcpy(target, sourceRow + static_cast<size_t>(sourceX) * 4, 4);
+						target += 4;
+					}
+				}
+
+				file.write(reinterpret_cast<const char*>(page.data()), static_cast<std::streamsize>(page.size()));
+			}
+		}
+	}
+
+	return file.good();
+}
+
+uint32 VirtualTextureFile::CalculateMipLevels(uint32 width, uint32 height, uint32 tileSize) noexcept
+{
+	uint32 mipLevels = 1;
+
+	while (MAX(width >> (mipLevels - 1), height >> (mipLevels - 1)) > tileSize)
+	{
+		mipLevels++;
+	}
+
+	return mipLevels;
+}
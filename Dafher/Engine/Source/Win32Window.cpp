@@ -0,0 +1,77 @@
+﻿#include "Win32Window.h"
+
+#ifdef _WIN32
+
+bool Win32Window::Init() noexcept
+{
+    HINSTANCE hInstance = GetModuleHandle(nullptr);
+
+    WNDCLASSEXW wcex = {};
+    wcex.cbSize = sizeof(WNDCLASSEX);
+    wcex.style = CS_HREDRAW | CS_VREDRAW;
+    wcex.lpfnWndProc = Procedure;
+    wcex.hInstance = hInstance;
+    wcex.hCursor = LoadCursor(nullptr, IDC_ARROW);
+    wcex.hbrBackground = (HBRUSH)(COLOR_WINDOW + 1);
+    wcex.lpszClassName = L"MinimalWindow";
+
+    RegisterClassExW(&wcex);
+
+    _hWnd = CreateWindowW(L"MinimalWindow", L"최소한의 창", WS_OVERLAPPEDWINDOW,
+        CW_USEDEFAULT, 0, CW_USEDEFAULT, 0, nullptr, nullptr, hInstance, nullptr);
+
+    ShowWindow(_hWnd, SW_SHOW);
+
+    return _hWnd != nullptr;
+}
+
+bool Win32Window::ProcessEvents() noexcept
+{
+    MSG msg;
+
+    while (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE))
+    {
+        if (msg.message == WM_QUIT)
+        {
+            return false;
+        }
+
+        TranslateMessage(&msg);
+        DispatchMessage(&msg);
+    }
+
+    return true;
+}
+
+uint32 Win32Window::GetWidth() const noexcept
+{
+    RECT rect;
+    GetClientRect(_hWnd, &rect);
+
+    return static_cast<uint32>(rect.right - rect.left);
+}
+
+uint32 Win32Window::GetHeight() const noexcept
+{
+    RECT rect;
+    GetClientRect(_hWnd, &rect);
+
+    return static_cast<uint32>(rect.bottom - rect.top);
+}
+
+LRESULT CALLBACK Win32Window::Procedure(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam) noexcept
+{
+    switch (message)
+    {
+    case WM_DESTROY:
+        PostQuitMessage(0);
+        break;
+
+    default:
+        return DefWindowProc(hWnd, message, wParam, lParam);
+    }
+
+    return 0;
+}
+
+#endif
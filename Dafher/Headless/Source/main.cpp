@@ -0,0 +1,559 @@
+#include "Engine.h"
+#include "NullRenderSubmitter.h"
+#include "RecordingBatchBackend.h"
+#include "RecordingGraphicContext.h"
+#include "Renderer.h"
+#include "RenderThread.h"
+#include "Scene.h"
+#include "Sprite.h"
+#include "Texture.h"
+#include "TextureAtlas.h"
+#include "TextureManager.h"
+#include "Transform.h"
+
+constexpr static uint32 FRAME_COUNT = 120;
+constexpr static uint32 FLIPBOOK_SPRITE_COUNT = 64;
+constexpr static uint32 SAMPLE_SPRITE_COUNT = 8;
+constexpr static uint32 SPRITE_COUNT = FLIPBOOK_SPRITE_COUNT + SAMPLE_SPRITE_COUNT;
+constexpr static uint32 BATCH_CAPACITY = 8;
+constexpr static uint32 BATCH_QUAD_COUNT = 20;
+constexpr static uint32 BUDGET_FRAME_COUNT = 16;
+constexpr static uint32 RESTREAM_FRAME_COUNT = 256;
+constexpr static uint32 ATLAS_PAGE_SIZE = 256;
+constexpr static uint32 ATLAS_IMAGE_SIZE = 62;
+constexpr static uint32 ATLAS_IMAGE_COUNT = 40;
+
+class HeldRenderSubmitter : public NullRenderSubmitter
+{
+public:
+	virtual void Render(const RenderSnapshot& snapshot) noexcept override
+	{
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_condition.wait(lock, [this]() { return !_isHeld; });
+		}
+
+		NullRenderSubmitter::Render(snapshot);
+	}
+
+	inline void SetHeld(bool isHeld) noexcept
+	{
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_isHeld = isHeld;
+		}
+
+		_condition.notify_all();
+	}
+
+private:
+	std::mutex _mutex;
+	std::condition_variable _condition;
+	bool _isHeld = false;
+};
+
+static Scene* CreateScene() noexcept
+{
+	Scene* scene = Scene::Create();
+	const Flipbook* flipbook = Engine::GetInstance()->GetTextureManager()->GetFlipbook("sprite_frame");
+
+	if (flipbook == nullptr)
+	{
+		return scene;
+	}
+
+	for (uint32 i = 0; i < FLIPBOOK_SPRITE_COUNT; ++i)
+	{
+		Node* node = Node::Create();
+		node->GetComponent<Transform>()->SetLocalPosition(
+			static_cast<float>(i % 8) * 96.0f - 336.0f, static_cast<float>(i / 8) * 72.0f - 252.0f);
+
+		Sprite* sprite = node->AddComponent<Sprite>();
+		sprite->SetFlipbook(flipbook);
+		sprite->SetBlendMode(i % 5 == 0 ? BlendMode::Additive : BlendMode::Alpha);
+		sprite->Play();
+
+		scene->AddChild(node);
+	}
+
+	for (uint32 i = 0; i < SAMPLE_SPRITE_COUNT; ++i)
+	{
+		Node* node = Node::Create();
+		node->GetComponent<Transform>()->SetLocalPosition(static_cast<float>(i) * 80.0f - 280.0f, 0.0f, 1.0f);
+
+		Sprite* sprite = Sprite::Create(TextureKey("Sample"), 64, 64);
+		sprite->SetOwner(node);
+		sprite->SetLayer(1);
+		node->_components.push_back(std::unique_ptr<Sprite>(sprite));
+
+		scene->AddChild(node);
+	}
+
+	return scene;
+}
+
+static int RunFrames(bool isRenderThreadEnabled) noexcept
+{
+	Engine* engine = Engine::GetInstance();
+
+	std::unique_ptr<NullRenderSubmitter> submitter = std::make_unique<NullRenderSubmitter>();
+	NullRenderSubmitter* nullSubmitter = submitter.get();
+	engine->SetRenderSubmitter(std::move(submitter));
+	engine->SetCurrentScene(CreateScene());
+	engine->SetRenderThreadEnabled(isRenderThreadEnabled);
+
+	const bool isRenderThreadRunning = engine->GetRenderThread()->IsRunning();
+
+	for (uint32 frame = 0; frame < FRAME_COUNT; ++frame)
+	{
+		engine->PreUpdate();
+		engine->Update();
+		engine->PostUpdate();
+	}
+
+	engine->SetRenderThreadEnabled(false);
+
+	// A key missing from the manifest resolves to the placeholder instead of failing.
+	TextureManager* textureManager = engine->GetTextureManager();
+	const TextureRegion* missingRegion = textureManager->Resolve(textureManager->GetHandle(TextureKey("missing_texture")));
+	const bool isPlaceholder = missingRegion != nullptr && missingRegion->_isResident &&
+		missingRegion == textureManager->GetTexture("missing_texture") &&
+		missingRegion->_texture == textureManager->GetTexture("missing_texture_2")->_texture;
+
+	std::printf("Headless%s: %llu frames, %llu views, %llu items, last frame %llu\n",
+		isRenderThreadRunning ? " (render thread)" : "",
+		static_cast<unsigned long long>(nullSubmitter->GetFrameCount()),
+		static_cast<unsigned long long>(nullSubmitter->GetViewCount()),
+		static_cast<unsigned long long>(nullSubmitter->GetItemCount()),
+		static_cast<unsigned long long>(nullSubmitter->GetLastFrameIndex()));
+
+	return isPlaceholder && isRenderThreadRunning == isRenderThreadEnabled &&
+		nullSubmitter->GetFrameCount() == FRAME_COUNT &&
+		nullSubmitter->GetLastFrameIndex() == FRAME_COUNT &&
+		engine->GetRenderThread()->GetPublishedFrameCount() == FRAME_COUNT &&
+		nullSubmitter->GetItemCount() == static_cast<uint64>(FRAME_COUNT) * SPRITE_COUNT ? 0 : 1;
+}
+
+static int CheckStateCache() noexcept
+{
+	Engine* engine = Engine::GetInstance();
+	Renderer* renderer = engine->GetRenderer();
+
+	RecordingGraphicContext context;
+	renderer->Init(&context);
+	engine->SetCurrentScene(CreateScene());
+
+	bool isValid = context.HasResources();
+
+	for (RenderMode renderMode : { RenderMode::Batched, RenderMode::Instanced })
+	{
+		renderer->SetRenderMode(renderMode);
+		renderer->InvalidateState();
+
+		for (uint32 frame = 0; frame < 4; ++frame)
+		{
+			engine->PreUpdate();
+			engine->Update();
+			engine->PostUpdate();
+
+			context.Reset();
+			renderer->Render(engine->GetRenderThread()->GetWriteSnapshot());
+
+			const RenderStateCache& stateCache = renderer->GetStateCache();
+			const BatchStats& batchStats = renderer->GetBatchStats();
+			const uint32 visibleCount = renderer->GetCullingStats()._visibleCount;
+			const GraphicBuffer batchBuffer = renderMode == RenderMode::Instanced ? GraphicBuffer::Instance : GraphicBuffer::BatchVertex;
+
+			// The queue sorts by layer, blend mode and texture, so every frame draws three ranges in one flush:
+			// the flipbook page with alpha blending, the same page with additive blending, then the Sample
+			// sprites on layer 1. The first frame after invalidation binds the whole pipeline once. Later
+			// frames start from the previous frame's state, so only the blend and texture changes are issued.
+			const bool isFirstFrame = frame == 0;
+			const bool isInstanced = renderMode == RenderMode::Instanced;
+			const uint32 pipelineIssued = isFirstFrame ? 1 : 0;
+			const uint32 expectedCounts[][2] =
+			{
+				{ pipelineIssued, 1 - pipelineIssued },                                 // RasterizerState
+				{ isFirstFrame ? 3u : 2u, isFirstFrame ? 0u : 1u },                     // BlendState
+				{ pipelineIssued, 1 - pipelineIssued },                                 // VertexShader
+				{ pipelineIssued, 1 - pipelineIssued },                                 // PixelShader
+				{ pipelineIssued, 1 - pipelineIssued },                                 // InputLayout
+				{ pipelineIssued, 1 - pipelineIssued },                                 // ConstantBuffer
+				{ pipelineIssued, 1 - pipelineIssued },                                 // Sampler
+				{ 2, 1 },                                                               // ShaderResource
+				{ pipelineIssued, 1 - pipelineIssued },                                 // VertexBuffer0
+				{ isInstanced ? pipelineIssued : 0, isInstanced ? 1 - pipelineIssued : 0 }, // VertexBuffer1
+				{ pipelineIssued, 1 - pipelineIssued },                                 // IndexBuffer
+				{ pipelineIssued, 1 - pipelineIssued },                                 // Topology
+			};
+			static_assert(std::size(expectedCounts) == static_cast<size_t>(RenderBinding::Count));
+
+			for (uint32 i = 0; i < static_cast<uint32>(RenderBinding::Count); ++i)
+			{
+				const RenderBinding binding = static_cast<RenderBinding>(i);
+
+				if (context.GetBindCount(binding) != expectedCounts[i][0] ||
+					stateCache.GetIssuedCount(binding) != expectedCounts[i][0] ||
+					stateCache.GetElidedCount(binding) != expectedCounts[i][1])
+				{
+					std::printf("Binding %u: %u context calls, %u issued and %u elided, expected %u issued and %u elided\n",
+						i, context.GetBindCount(binding), stateCache.GetIssuedCount(binding),
+						stateCache.GetElidedCount(binding), expectedCounts[i][0], expectedCounts[i][1]);
+					isValid = false;
+				}
+			}
+
+			isValid &= visibleCount == SPRITE_COUNT;
+			isValid &= context.GetViewportCount() == 1;
+			isValid &= context.GetDrawCount() == batchStats._rangeCount;
+			isValid &= context.GetBufferUpdateCount(batchBuffer) == batchStats._flushCount;
+			isValid &= context.GetIndexCount() == static_cast<uint64>(visibleCount) * 6;
+			isValid &= renderMode == RenderMode::Batched || context.GetInstanceCount() == visibleCount;
+			isValid &= batchStats._flushCount == 1 && batchStats._rangeCount == 3;
+
+			std::printf("%s frame %u: %u draws, %u issued, %u elided\n",
+				renderMode == RenderMode::Instanced ? "Instanced" : "Batched", frame,
+				context.GetDrawCount(), stateCache.GetIssuedCount(), stateCache.GetElidedCount());
+		}
+	}
+
+	return isValid ? 0 : 1;
+}
+
+static void RunHeldFrame(HeldRenderSubmitter* submitter, const std::function<void()>& onPreUpdate) noexcept
+{
+	Engine* engine = Engine::GetInstance();
+
+	// The frame published last is held on the render thread, so anything the simulation retires in
+	// PreUpdate is still referenced by a snapshot that has not been rendered yet.
+	engine->PreUpdate();
+	onPreUpdate();
+
+	submitter->SetHeld(false);
+	engine->GetRenderThread()->WaitIdle();
+	submitter->SetHeld(true);
+
+	engine->Update();
+	engine->PostUpdate();
+}
+
+static int CheckBudget() noexcept
+{
+	Engine* engine = Engine::GetInstance();
+	TextureManager* textureManager = engine->GetTextureManager();
+
+	// The null device creates no GPU textures, so the budget would never see any memory to evict.
+	// Pack textures stay mapped, so loose loading is forced to cover decoding a discarded source again.
+	RecordingGraphicContext context;
+	textureManager->Clear();
+	textureManager->Init(&context);
+	textureManager->SetPackEnabled(false);
+
+	std::unique_ptr<HeldRenderSubmitter> submitter = std::make_unique<HeldRenderSubmitter>();
+	HeldRenderSubmitter* heldSubmitter = submitter.get();
+	engine->SetRenderSubmitter(std::move(submitter));
+
+	Scene* scene = CreateScene();
+	engine->SetCurrentScene(scene);
+	engine->SetRenderThreadEnabled(true);
+	heldSubmitter->SetHeld(true);
+
+	for (uint32 frame = 0; frame < 4; ++frame)
+	{
+		RunHeldFrame(heldSubmitter, []() {});
+	}
+
+	const TextureRegion* region = textureManager->Resolve(textureManager->GetHandle(TextureKey("Sample")));
+	bool isValid = region != nullptr && region->_isResident && textureManager->GetVariantCache().GetStats()._variantCount == 1;
+
+	std::vector<Node*> sampleNodes;
+
+	for (const std::unique_ptr<Node>& child : scene->GetChildren())
+	{
+		if (child->GetComponent<Sprite>()->GetLayer() == 1)
+		{
+			sampleNodes.push_back(child.get());
+		}
+	}
+
+	for (Node* node : sampleNodes)
+	{
+		scene->RemoveChild(node);
+	}
+
+	textureManager->GetBudget().SetGpuBudget(1);
+
+	uint32 evictedCount = 0;
+	uint32 retiredCount = 0;
+	uint32 heldRetiredCount = 0;
+
+	for (uint32 frame = 0; frame < BUDGET_FRAME_COUNT; ++frame)
+	{
+		RunHeldFrame(heldSubmitter, [textureManager, &evictedCount, &retiredCount, &heldRetiredCount]()
+			{
+				const uint32 frameEvictedCount = textureManager->GetMemoryStats()._evictedCount;
+
+				if (frameEvictedCount != evictedCount)
+				{
+					heldRetiredCount = textureManager->GetRetiredTextureCount();
+				}
+
+				evictedCount = frameEvictedCount;
+				retiredCount = textureManager->GetRetiredTextureCount();
+			});
+	}
+
+	isValid &= evictedCount == 1 && heldRetiredCount == 2 && retiredCount == 0;
+	isValid &= !region->_isResident && !textureManager->GetEvictionLog().empty() &&
+		textureManager->GetEvictionLog().back()._key == "Sample";
+	isValid &= textureManager->GetVariantCache().GetStats()._variantCount == 0;
+
+	Node* node = Node::Create();
+	Sprite* sprite = Sprite::Create(TextureKey("Sample"));
+	sprite->SetOwner(node);
+	node->_components.push_back(std::unique_ptr<Sprite>(sprite));
+	scene->AddChild(node);
+
+	for (uint32 frame = 0; frame < RESTREAM_FRAME_COUNT && !region->_isResident; ++frame)
+	{
+		RunHeldFrame(heldSubmitter, []() {});
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	for (uint32 frame = 0; frame < BUDGET_FRAME_COUNT; ++frame)
+	{
+		RunHeldFrame(heldSubmitter, []() {});
+	}
+
+	// The restreamed copy has been uploaded and discarded, so resizing has to decode the source again.
+	const bool isDiscarded = region->_isResident && !region->_texture->HasImageData();
+	sprite->SetSize(96, 128);
+
+	for (uint32 frame = 0; frame < 4; ++frame)
+	{
+		RunHeldFrame(heldSubmitter, []() {});
+	}
+
+	isValid &= isDiscarded && region->_texture->HasImageData() &&
+		textureManager->GetVariantCache().GetStats()._variantCount == 1;
+
+	heldSubmitter->SetHeld(false);
+	engine->SetRenderThreadEnabled(false);
+
+	const TextureMemoryStats& memoryStats = textureManager->GetMemoryStats();
+	isValid &= region->_isResident && memoryStats._restreamedCount == 1 && memoryStats._evictedCount == 1;
+
+	std::printf("Budget: %u evicted, %u retired while held, %u restreamed, %u KB of %u KB on the GPU\n",
+		memoryStats._evictedCount, heldRetiredCount, memoryStats._restreamedCount,
+		static_cast<uint32>(memoryStats._gpuBytes / 1024), static_cast<uint32>(memoryStats._gpuBudget / 1024));
+
+	return isValid ? 0 : 1;
+}
+
+static inline bool IsEqual(const BatchVertex& vertex, float x, float y, float z, float u, float v, const Color& color) noexcept
+{
+	return vertex._x == x && vertex._y == y && vertex._z == z && vertex._u == u && vertex._v == v &&
+		vertex._r == color.R() && vertex._g == color.G() && vertex._b == color.B() && vertex._a == color.A();
+}
+
+static int CheckBatches() noexcept
+{
+	Texture textureA;
+	Texture textureB;
+
+	const RecordedDraw expectedDraws[] =
+	{
+		{ &textureA, 0, 0, 6, BlendMode::Alpha },
+		{ &textureB, 0, 6, 2, BlendMode::Alpha },
+		{ &textureB, 1, 8, 4, BlendMode::Alpha },
+		{ &textureA, 1, 12, 3, BlendMode::Alpha },
+		{ &textureA, 1, 15, 1, BlendMode::Additive },
+		{ &textureA, 2, 16, 2, BlendMode::Additive },
+		{ &textureA, 2, 18, 2, BlendMode::Alpha },
+	};
+	constexpr uint32 expectedDrawCount = static_cast<uint32>(std::size(expectedDraws));
+
+	std::array<InstanceData, BATCH_QUAD_COUNT> instances;
+	std::array<Texture*, BATCH_QUAD_COUNT> textures;
+	std::array<BlendMode, BATCH_QUAD_COUNT> blendModes;
+
+	for (uint32 i = 0; i < BATCH_QUAD_COUNT; ++i)
+	{
+		const float size = static_cast<float>(i + 1);
+		const Matrix worldMatrix = Matrix::CreateScale(size, size * 2.0f, 1.0f) *
+			Matrix::CreateTranslation(static_cast<float>(i) * 10.0f, static_cast<float>(i) * -5.0f, 0.5f);
+
+		InstanceBatch::Pack(instances[i], worldMatrix, Vector4(0.0f, 0.25f, 0.5f, 0.75f),
+			Color(static_cast<float>(i) / BATCH_QUAD_COUNT, 0.5f, 1.0f, 1.0f));
+		textures[i] = i >= 6 && i < 12 ? &textureB : &textureA;
+		blendModes[i] = i >= 15 && i < 18 ? BlendMode::Additive : BlendMode::Alpha;
+	}
+
+	RecordingBatchBackend quadBackend;
+	QuadBatch quadBatch(BATCH_CAPACITY);
+	quadBatch.SetBackend(&quadBackend);
+	quadBatch.Begin();
+
+	for (uint32 i = 0; i < BATCH_QUAD_COUNT; ++i)
+	{
+		quadBatch.Submit(textures[i], instances[i], blendModes[i]);
+	}
+
+	quadBatch.End();
+
+	RecordingBatchBackend instanceBackend;
+	InstanceBatch instanceBatch(BATCH_CAPACITY);
+	instanceBatch.SetBackend(&instanceBackend);
+	instanceBatch.Begin();
+
+	for (uint32 i = 0; i < BATCH_QUAD_COUNT; ++i)
+	{
+		instanceBatch.Submit(textures[i], instances[i], blendModes[i]);
+	}
+
+	instanceBatch.End();
+
+	bool isValid = quadBackend.GetFlushCount() == 3 && instanceBackend.GetFlushCount() == 3 &&
+		quadBackend.GetDrawCount() == expectedDrawCount && instanceBackend.GetDrawCount() == expectedDrawCount &&
+		quadBackend.GetVertices().size() == static_cast<size_t>(BATCH_QUAD_COUNT) * 4 &&
+		instanceBackend.GetInstances().size() == BATCH_QUAD_COUNT &&
+		quadBatch.GetStats()._flushCount == 3 && quadBatch.GetStats()._rangeCount == expectedDrawCount &&
+		instanceBatch.GetStats()._flushCount == 3 && instanceBatch.GetStats()._rangeCount == expectedDrawCount;
+
+	for (uint32 i = 0; isValid && i < expectedDrawCount; ++i)
+	{
+		const RecordedDraw& expected = expectedDraws[i];
+		const RecordedDraw& quadDraw = quadBackend.GetDraws()[i];
+		const RecordedDraw& instanceDraw = instanceBackend.GetDraws()[i];
+
+		isValid &= quadDraw._texture == expected._texture && quadDraw._flushIndex == expected._flushIndex &&
+			quadDraw._first == expected._first * 4 && quadDraw._count == expected._count * 4 &&
+			quadDraw._blendMode == expected._blendMode;
+		isValid &= instanceDraw._texture == expected._texture && instanceDraw._flushIndex == expected._flushIndex &&
+			instanceDraw._first == expected._first && instanceDraw._count == expected._count &&
+			instanceDraw._blendMode == expected._blendMode;
+	}
+
+	for (uint32 i = 0; isValid && i < BATCH_QUAD_COUNT; ++i)
+	{
+		const InstanceData& instance = instances[i];
+		const InstanceData& recorded = instanceBackend.GetInstances()[i];
+		const BatchVertex* vertex = &quadBackend.GetVertices()[static_cast<size_t>(i) * 4];
+
+		const float x = instance._translation.x;
+		const float y = instance._translation.y;
+		const float z = instance._translation.z;
+		const float width = instance._axes.x;
+		const float height = instance._axes.w;
+		const Vector4& uvRect = instance._uvRect;
+
+		isValid &= std::memcmp(&recorded, &instance, sizeof(InstanceData)) == 0;
+		isValid &= width == static_cast<float>(i + 1) && instance._axes.y == 0.0f && instance._axes.z == 0.0f;
+		isValid &= IsEqual(vertex[0], x, y + height, z, uvRect.x, uvRect.y, instance._color);
+		isValid &= IsEqual(vertex[1], x + width, y + height, z, uvRect.z, uvRect.y, instance._color);
+		isValid &= IsEqual(vertex[2], x + width, y, z, uvRect.z, uvRect.w, instance._color);
+		isValid &= IsEqual(vertex[3], x, y, z, uvRect.x, uvRect.w, instance._color);
+	}
+
+	std::printf("Batches: %u quad draws in %u flushes, %u instance draws in %u flushes\n",
+		quadBackend.GetDrawCount(), quadBackend.GetFlushCount(),
+		instanceBackend.GetDrawCount(), instanceBackend.GetFlushCount());
+
+	return isValid ? 0 : 1;
+}
+
+static bool CheckAtlasPages(TextureAtlas& atlas, const std::vector<AtlasImage>& images) noexcept
+{
+	bool isValid = atlas.GetPages().size() == atlas.GetPageCount();
+	const uint32 pageSize = atlas.GetPageSize();
+
+	for (size_t i = 0; isValid && i < images.size(); ++i)
+	{
+		const AtlasPlacement& placement = atlas.GetPlacements()[i];
+
+		if (!placement._isPacked)
+		{
+			continue;
+		}
+
+		const std::vector<uint8>& page = atlas.GetPages()[placement._page];
+		const size_t first = (static_cast<size_t>(placement._y) * pageSize + placement._x) * 4;
+		const size_t last = (static_cast<size_t>(placement._y + images[i]._height - 1) * pageSize +
+			placement._x + images[i]._width - 1) * 4;
+		const Vector4 uvRect = atlas.GetUVRect(i);
+
+		isValid &= placement._x + images[i]._width <= pageSize && placement._y + images[i]._height <= pageSize;
+		isValid &= page.size() == static_cast<size_t>(pageSize) * pageSize * 4;
+		isValid &= page[first] == images[i]._pixels[0] && page[last] == images[i]._pixels[0];
+		isValid &= uvRect.x * pageSize == placement._x && uvRect.w * pageSize == placement._y + images[i]._height;
+	}
+
+	return isValid;
+}
+
+static int CheckAtlas() noexcept
+{
+	std::vector<std::vector<uint8>> pixels(ATLAS_IMAGE_COUNT + 1);
+	std::vector<AtlasImage> images;
+
+	for (uint32 i = 0; i < ATLAS_IMAGE_COUNT; ++i)
+	{
+		pixels[i].assign(static_cast<size_t>(ATLAS_IMAGE_SIZE) * ATLAS_IMAGE_SIZE * 4, static_cast<uint8>(i + 1));
+		images.push_back({ pixels[i].data(), ATLAS_IMAGE_SIZE, ATLAS_IMAGE_SIZE });
+	}
+
+	pixels[ATLAS_IMAGE_COUNT].assign(static_cast<size_t>(ATLAS_PAGE_SIZE) * ATLAS_PAGE_SIZE * 4, 0xFF);
+	images.push_back({ pixels[ATLAS_IMAGE_COUNT].data(), ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE });
+
+	// With the default padding each image takes a 64x64 cell, so a page holds exactly 16 of them and the
+	// last page is half full. The page-sized image does not fit once padded and is rejected.
+	TextureAtlas atlas(ATLAS_PAGE_SIZE);
+	bool isValid = atlas.Build(images);
+
+	const AtlasStats& stats = atlas.GetStats();
+	const uint32 cellSize = ATLAS_IMAGE_SIZE + TextureAtlas::DEFAULT_PADDING * 2;
+	const uint32 cellsPerPage = (ATLAS_PAGE_SIZE / cellSize) * (ATLAS_PAGE_SIZE / cellSize);
+	const uint32 expectedPageCount = (ATLAS_IMAGE_COUNT + cellsPerPage - 1) / cellsPerPage;
+	const float expectedEfficiency = static_cast<float>(ATLAS_IMAGE_COUNT * cellSize * cellSize) /
+		static_cast<float>(expectedPageCount * ATLAS_PAGE_SIZE * ATLAS_PAGE_SIZE);
+
+	isValid &= stats._pageCount == expectedPageCount && stats._packedCount == ATLAS_IMAGE_COUNT &&
+		stats._rejectedCount == 1 && atlas.GetPageSize() == ATLAS_PAGE_SIZE;
+	isValid &= std::abs(stats._efficiency - expectedEfficiency) < 0.001f;
+	isValid &= CheckAtlasPages(atlas, images);
+
+	std::printf("Atlas: %u images in %u pages of %u, %u rejected, %d%% used\n",
+		stats._packedCount, stats._pageCount, atlas.GetPageSize(), stats._rejectedCount,
+		static_cast<int32>(stats._efficiency * 100.0f));
+
+	// A small batch, like the textures one frame requests lazily, gets a single page trimmed to a 2x2 block of cells.
+	images.resize(4);
+
+	TextureAtlas batchAtlas;
+	isValid &= batchAtlas.Build(images);
+
+	const AtlasStats& batchStats = batchAtlas.GetStats();
+	isValid &= batchStats._pageCount == 1 && batchStats._packedCount == 4 && batchAtlas.GetPageSize() == cellSize * 2;
+	isValid &= batchStats._efficiency == 1.0f;
+	isValid &= CheckAtlasPages(batchAtlas, images);
+
+	std::printf("Atlas batch: %u images in %u page of %u, %d%% used\n",
+		batchStats._packedCount, batchStats._pageCount, batchAtlas.GetPageSize(),
+		static_cast<int32>(batchStats._efficiency * 100.0f));
+
+	return isValid ? 0 : 1;
+}
+
+int main(int argc, char* argv[])
+{
+	Engine::GetInstance()->Init(true);
+
+	const std::string_view mode = argc > 1 ? argv[1] : "";
+	const int result = mode == "--check-state-cache" ? CheckStateCache() :
+		mode == "--check-batch" ? CheckBatches() :
+		mode == "--check-budget" ? CheckBudget() :
+		mode == "--check-atlas" ? CheckAtlas() : RunFrames(mode == "--render-thread");
+	Engine::GetInstance()->Clear();
+
+	return result;
+}